@@ -31,6 +31,10 @@ struct CoupledControlsDemo : public sst::jucegui::components::WindowPanel
             source1 = std::make_unique<ConcreteCM>();
             source2 = std::make_unique<ConcreteCM>();
             source1->min = -1;
+            // source2 is only updated at 10hz from the model so let the editors glide
+            source2->smoothingTime = 0.15;
+            // and source1 shows a live modulation feed as if from an lfo on the audio thread
+            source1->liveFeed = std::make_unique<sst::jucegui::data::LiveModulationFeed>();
             source0->setValueFromGUI(0.9);
             source1->setValueFromGUI(0.44);
             source2->setValueFromGUI(0.0);
@@ -77,12 +81,22 @@ struct CoupledControlsDemo : public sst::jucegui::components::WindowPanel
         }
 
         float ival = 0.f;
+        int idleCount{0};
+        float lfoPhase{0.f};
         void idle()
         {
             ival += 0.01 * source0->getValue();
             if (ival >= 1)
                 ival -= 1.f;
-            source2->setValueFromModel(ival);
+            if (idleCount++ % 6 == 0)
+                source2->setValueFromModel(ival);
+
+            lfoPhase += 0.02;
+            if (lfoPhase >= 1)
+                lfoPhase -= 1.f;
+            auto lfo = source1->getValue01() +
+                       0.3f * std::sin(2 * juce::MathConstants<float>::pi * lfoPhase);
+            source1->liveFeed->push(std::clamp(lfo, 0.f, 1.f));
         }
         void resized() override
         {
@@ -58,10 +58,25 @@ struct ConcreteCM : sst::jucegui::data::ContinunousModulatable
     float getMin() const override { return min; }
     float getMax() const override { return max; }
 
+    float smoothingTime{0};
+    float getDisplaySmoothingTime() const override { return smoothingTime; }
+
+    std::shared_ptr<sst::jucegui::data::ContinuousMapping> mapping;
+    const sst::jucegui::data::ContinuousMapping *getMapping() const override
+    {
+        return mapping.get();
+    }
+
     float mv{0.2};
     float getModulationValuePM1() const override { return mv; }
     void setModulationValuePM1(const float &f) override { mv = f; }
     bool isModulationBipolar() const override { return isBipolar(); } // sure why not
+
+    std::unique_ptr<sst::jucegui::data::LiveModulationFeed> liveFeed;
+    const sst::jucegui::data::LiveModulationFeed *getLiveModulationFeed() const override
+    {
+        return liveFeed.get();
+    }
 };
 
 struct ConcreteBinM : sst::jucegui::data::BinaryDiscrete
@@ -55,7 +55,15 @@ struct HSliderDemo : public sst::jucegui::components::WindowPanel
                     break;
                 }
 
-                d->setValueFromGUI(1.0 * (rand() % 18502) / 18502.f);
+                // the middle slider of each unipolar row is a frequency on a log taper
+                if ((i / 3) % 2 == 0 && i % 3 == 1)
+                {
+                    d->min = 20;
+                    d->max = 20000;
+                    d->mapping = std::make_shared<sst::jucegui::data::LogMapping>(20.f, 20000.f);
+                }
+
+                d->setValueFromGUI(d->value01ToValue(1.0 * (rand() % 18502) / 18502.f));
                 k->setSource(d.get());
                 k->onBeginEdit = []() {
                     std::cout << __FILE__ << ":" << __LINE__ << " beginEdit" << std::endl;
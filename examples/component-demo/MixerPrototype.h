@@ -48,6 +48,27 @@ struct MixerProto : public sst::jucegui::components::WindowPanel
             lab = std::make_unique<cmp::Label>();
             lab->setText(label);
             addAndMakeVisible(*lab);
+
+            // Solo and mute share the top row, a pixel in from the edges, over the pan
+            // knob, the level slider and the label
+            namespace sty = sst::jucegui::style;
+            using tracks = sty::LayoutTree::Tracks;
+            auto &strip = layout.node(tracks::VERTICAL);
+            auto &buttons = layout.node(tracks::HORIZONTAL);
+            buttons.add(sty::Track::fixed(1))
+                .add(sty::Track::weight(), solo.get())
+                .add(sty::Track::fixed(2))
+                .add(sty::Track::weight(), mute.get())
+                .add(sty::Track::fixed(1));
+            strip.add(sty::Track::fixed(1))
+                .add(sty::Track::fixed(18), buttons)
+                .add(sty::Track::fixed(3))
+                .add(sty::Track::fixed(0), pan.get())
+                .add(sty::Track::fixed(2))
+                .add(sty::Track::weight(), level.get())
+                .add(sty::Track::fixed(17), lab.get());
+            stripNode = &strip;
+            buttonsNode = &buttons;
         }
 
         ~Channel()
@@ -66,30 +87,29 @@ struct MixerProto : public sst::jucegui::components::WindowPanel
         ConcreteCM levCM, panCM;
         ConcreteBinM muteBM, soloBM;
 
-        void resized()
-        {
-            auto b = getLocalBounds();
-            auto w = b.getWidth();
-            auto t = b.withHeight(20);
-            auto k = b.withHeight(w).translated(0, 22);
-            auto s = b.withTrimmedTop(20 + w + 4).withTrimmedBottom(17);
-            auto l = b.withTop(s.getBottom());
-
-            pan->setBounds(k);
-            level->setBounds(s);
+        sst::jucegui::style::LayoutTree layout;
+        sst::jucegui::style::LayoutTree::Node *stripNode{nullptr}, *buttonsNode{nullptr};
+        static constexpr size_t panTrack{3};
 
-            solo->setBounds(t.withWidth(t.getWidth() / 2).reduced(1));
-            mute->setBounds(t.withTrimmedLeft(t.getWidth() / 2).reduced(1));
-
-            lab->setBounds(l);
+        void resized() override
+        {
+            // The pan knob is square, so its track follows the width
+            auto w = getWidth();
+            if (stripNode->track(panTrack).amount != w)
+            {
+                stripNode->track(panTrack) = sst::jucegui::style::Track::fixed(w);
+                stripNode->invalidate();
+            }
+            layout.apply(getLocalBounds());
         }
     };
 
     struct Mixer : juce::Component
     {
+        static constexpr size_t nChannels{12};
         Mixer()
         {
-            for (int i = 0; i < 12; ++i)
+            for (size_t i = 0; i < nChannels; ++i)
             {
                 auto c = std::make_unique<Channel>(std::to_string(i));
                 addAndMakeVisible(*c);
@@ -99,15 +119,11 @@ struct MixerProto : public sst::jucegui::components::WindowPanel
         ~Mixer() {}
         void resized() override
         {
-            auto b = getLocalBounds();
-            auto e = sst::jucegui::style::EvenDivision<float>(
-                b.toFloat(), channels.size(), sst::jucegui::style::EvenDivision<float>::HORIZONTAL);
-            auto r = e.begin();
-            for (const auto &c : channels)
-            {
-                c->setBounds((*r).toNearestInt());
-                r++;
-            }
+            namespace sty = sst::jucegui::style;
+            auto tl = sty::TrackLayout<nChannels>().add(sty::Track::weight(), channels.size());
+            auto r = tl.layout(getLocalBounds());
+            for (size_t i = 0; i < channels.size(); ++i)
+                channels[i]->setBounds(r[i]);
         }
         std::vector<std::unique_ptr<Channel>> channels;
     };
@@ -7,47 +7,94 @@
 
 #include "sst/jucegui/util/DebugHelpers.h"
 #include "sst/jucegui/data/TreeTable.h"
+#include "sst/jucegui/data/TreeSearchIndex.h"
 #include "sst/jucegui/components/TabularizedTreeViewer.h"
 #include "sst/jucegui/components/NamedPanel.h"
 #include <filesystem>
+#include <atomic>
+#include <chrono>
+#include <map>
 
-struct FSTreeDataEntry : public sst::jucegui::data::TreeTableData::Entry
+struct FSTreeData;
+
+/*
+ * What a listing knows of a path. It is read on the worker from the directory entry,
+ * so building an entry on the message thread never touches the disk.
+ */
+struct FSListing
 {
-    const std::filesystem::path &path;
+    std::filesystem::path path;
     bool isDir{false};
-    uint32_t childCount{0};
-    std::vector<std::unique_ptr<Entry>> children;
-    std::vector<std::filesystem::path> childPaths;
+    int64_t size{0}, modified{0};
 
-    FSTreeDataEntry(const std::filesystem::path &p) : path(p)
+    static FSListing of(const std::filesystem::directory_entry &d)
     {
-        if (std::filesystem::is_directory(path))
+        FSListing res;
+        res.path = d.path();
+        std::error_code ec;
+        res.isDir = d.is_directory(ec);
+        if (!res.isDir)
         {
-            isDir = true;
-
-            for (auto const &dir_entry : std::filesystem::directory_iterator{path})
-            {
-                childPaths.push_back(dir_entry.path());
-                childCount++;
-            }
-            children.resize(childCount);
+            auto sz = d.file_size(ec);
+            res.size = ec ? 0 : (int64_t)sz;
         }
+        auto ft = d.last_write_time(ec);
+        if (!ec)
+        {
+            // file_time_type has no portable epoch in C++17, so go via the two clocks' now
+            using namespace std::chrono;
+            auto st = system_clock::now() +
+                      duration_cast<system_clock::duration>(
+                          ft - std::filesystem::file_time_type::clock::now());
+            res.modified = duration_cast<milliseconds>(st.time_since_epoch()).count();
+        }
+        return res;
     }
+};
 
-    bool hasChildren() const override { return isDir; }
+/*
+ * Directories are listed on a worker thread the first time they are opened, so a slow or
+ * network mounted disk never blocks the GUI. Listings arrive on the message thread in
+ * batches and the view shows them as they come. Rescanning lists a directory again and
+ * swaps in the new listing at once, keeping the entries for paths which are still there.
+ */
+struct FSTreeDataEntry : public sst::jucegui::data::TreeTableData::Entry
+{
+    FSTreeData &owner;
+    std::filesystem::path path;
+    bool isDir{false};
+    std::vector<std::unique_ptr<Entry>> children;
+    std::vector<FSListing> childListings;
+
+    ChildState childState{LOADING};
+    bool requested{false};
+    std::shared_ptr<std::atomic<bool>> alive{std::make_shared<std::atomic<bool>>(true)};
 
-    void buildChildren()
+    int64_t size{0}, modified{0};
+
+    FSTreeDataEntry(FSTreeData &o, const FSListing &l)
+        : owner(o), path(l.path), isDir(l.isDir), size(l.size), modified(l.modified)
+    {
+        id = std::hash<std::string>()(path.u8string());
+        if (!isDir)
+            childState = READY;
+    }
+    // The root alone is looked up where it is made
+    FSTreeDataEntry(FSTreeData &o, const std::filesystem::path &p)
+        : FSTreeDataEntry(o, FSListing::of(std::filesystem::directory_entry(p)))
     {
-        assert(isDir);
-        if (!children.empty())
-            return;
     }
+    ~FSTreeDataEntry() { *alive = false; }
+
+    bool hasChildren() const override { return isDir; }
+    ChildState getChildState() const override { return childState; }
+    void requestChildren() override;
 
     uint32_t getChildCount() const override { return children.size(); }
     const std::unique_ptr<Entry> &getChildAt(uint32_t idx) override
     {
         if (!children[idx])
-            children[idx] = std::make_unique<FSTreeDataEntry>(childPaths[idx]);
+            children[idx] = std::make_unique<FSTreeDataEntry>(owner, childListings[idx]);
         return children[idx];
     }
     std::string getLabel() const override
@@ -57,29 +104,187 @@ struct FSTreeDataEntry : public sst::jucegui::data::TreeTableData::Entry
             return "/";
         return res;
     }
+    sst::jucegui::data::ColumnValue getDataForColumn(uint32_t col) const override
+    {
+        if (col == 1)
+            return isDir ? sst::jucegui::data::ColumnValue{}
+                         : sst::jucegui::data::ColumnValue::ofSize(size);
+        if (col == 2)
+            return sst::jucegui::data::ColumnValue::ofDate(modified);
+        return Entry::getDataForColumn(col);
+    }
+
+    void addBatch(std::vector<FSListing> &&batch, bool last);
+
+    // List this and every directory below it which has been listed again
+    void rescan();
+    void replaceChildren(std::vector<FSListing> &&listing);
 };
 
 struct FSTreeData : public sst::jucegui::data::TreeTableData
 {
+    // Declared before the root so it is destroyed after it, which waits for listing jobs
+    juce::ThreadPool listingPool{2};
     std::unique_ptr<Entry> root;
     FSTreeData()
     {
 #if JUCE_WINDOWS
-        root = std::make_unique<FSTreeDataEntry>(std::filesystem::path{"c:/Users"});
+        root = std::make_unique<FSTreeDataEntry>(*this, std::filesystem::path{"c:/Users"});
 #else
-        root = std::make_unique<FSTreeDataEntry>(std::filesystem::path{"/Users"});
+        root = std::make_unique<FSTreeDataEntry>(*this, std::filesystem::path{"/Users"});
 #endif
     }
+    ~FSTreeData()
+    {
+        root.reset();
+        listingPool.removeAllJobs(true, 2000);
+    }
     const std::unique_ptr<Entry> &getRoot() const override { return root; }
+
+    uint32_t getColumnCount() const override { return 3; }
+    sst::jucegui::data::ColumnInfo getColumnInfo(uint32_t col) const override
+    {
+        using cv = sst::jucegui::data::ColumnValue;
+        switch (col)
+        {
+        case 1:
+            return {"Size", cv::SIZE, 80};
+        case 2:
+            return {"Modified", cv::DATE, 130};
+        }
+        return TreeTableData::getColumnInfo(col);
+    }
+};
+
+struct TreeWithHeader : juce::Component
+{
+    sst::jucegui::components::TabularizedTreeViewerHeader header;
+    sst::jucegui::components::TabularizedTreeViewer viewer;
+    // The viewer sizes itself to its rows inside the viewport, which scrolls them
+    juce::Viewport viewport;
+    TreeWithHeader()
+    {
+        header.setViewer(&viewer);
+        addAndMakeVisible(header);
+        viewport.setScrollBarsShown(true, false);
+        viewport.setViewedComponent(&viewer, false);
+        addAndMakeVisible(viewport);
+    }
+    void resized() override
+    {
+        auto b = getLocalBounds();
+        // the vertical scrollbar is always shown, so keep the header's columns over the rows
+        header.setBounds(b.removeFromTop(20).withTrimmedRight(viewport.getScrollBarThickness()));
+        viewport.setBounds(b);
+        viewer.sizeToViewport();
+    }
 };
 
-struct TreeTableFileSystem : public sst::jucegui::components::WindowPanel
+inline void FSTreeDataEntry::requestChildren()
+{
+    if (requested || !isDir)
+        return;
+    requested = true;
+
+    owner.listingPool.addJob([p = path, a = alive, e = this]() {
+        static constexpr size_t batchSize{64};
+        std::vector<FSListing> batch;
+        auto send = [&](bool last) {
+            juce::MessageManager::callAsync([a, e, b = std::move(batch), last]() mutable {
+                if (*a)
+                    e->addBatch(std::move(b), last);
+            });
+            batch = {};
+        };
+
+        std::error_code ec;
+        for (auto it = std::filesystem::directory_iterator{p, ec};
+             !ec && it != std::filesystem::directory_iterator{} && *a; it.increment(ec))
+        {
+            batch.push_back(FSListing::of(*it));
+            if (batch.size() == batchSize)
+                send(false);
+        }
+        send(true);
+    });
+}
+
+inline void FSTreeDataEntry::rescan()
+{
+    if (!isDir || childState != READY)
+        return;
+
+    for (auto &c : children)
+        if (c)
+            static_cast<FSTreeDataEntry *>(c.get())->rescan();
+
+    owner.listingPool.addJob([p = path, a = alive, e = this]() {
+        std::vector<FSListing> listing;
+        std::error_code ec;
+        for (auto it = std::filesystem::directory_iterator{p, ec};
+             !ec && it != std::filesystem::directory_iterator{} && *a; it.increment(ec))
+            listing.push_back(FSListing::of(*it));
+        juce::MessageManager::callAsync([a, e, l = std::move(listing)]() mutable {
+            if (*a)
+                e->replaceChildren(std::move(l));
+        });
+    });
+}
+
+inline void FSTreeDataEntry::replaceChildren(std::vector<FSListing> &&listing)
+{
+    // Entries for paths which went away live until the views have let go of them
+    std::map<std::filesystem::path, std::unique_ptr<Entry>> previous;
+    for (size_t i = 0; i < children.size(); ++i)
+        if (children[i])
+            previous[childListings[i].path] = std::move(children[i]);
+
+    childListings = std::move(listing);
+    children.clear();
+    children.resize(childListings.size());
+    for (size_t i = 0; i < childListings.size(); ++i)
+    {
+        auto it = previous.find(childListings[i].path);
+        if (it != previous.end())
+        {
+            auto *e = static_cast<FSTreeDataEntry *>(it->second.get());
+            e->size = childListings[i].size;
+            e->modified = childListings[i].modified;
+            children[i] = std::move(it->second);
+        }
+    }
+    owner.notifyChildrenReplaced(this);
+}
+
+inline void FSTreeDataEntry::addBatch(std::vector<FSListing> &&batch, bool last)
+{
+    auto from = (uint32_t)children.size();
+    for (auto &l : batch)
+        childListings.push_back(std::move(l));
+    children.resize(childListings.size());
+    if (children.size() > from)
+        owner.notifyChildrenAdded(this, from, children.size() - from);
+    if (last)
+    {
+        childState = READY;
+        owner.notifyChildrenComplete(this);
+    }
+}
+
+struct TreeTableFileSystem : public sst::jucegui::components::WindowPanel, juce::Timer
 {
     static constexpr const char *name = "TreeTableFileSystem";
 
-    std::unique_ptr<sst::jucegui::components::NamedPanel> panel;
+    // The viewer listens to the view, so the data outlives the panel which holds it
     std::unique_ptr<sst::jucegui::data::TreeTableData> treedata;
     std::unique_ptr<sst::jucegui::data::TabularizedTreeView> tablularizeddata;
+    std::unique_ptr<sst::jucegui::data::TreeSearchIndex> searchIndex;
+    std::unique_ptr<sst::jucegui::data::FilteredTabularizedViewOfTree> filtereddata;
+    std::unique_ptr<sst::jucegui::components::NamedPanel> panel;
+    std::unique_ptr<juce::TextEditor> search;
+    std::unique_ptr<juce::TextButton> rescan;
+    sst::jucegui::components::TabularizedTreeViewer *viewer{nullptr};
+    uint64_t shownGeneration{0};
 
     TreeTableFileSystem()
     {
@@ -88,15 +293,68 @@ struct TreeTableFileSystem : public sst::jucegui::components::WindowPanel
         treedata = std::make_unique<FSTreeData>();
         tablularizeddata =
             std::make_unique<sst::jucegui::data::ConcreteTabularizedViewOfTree>(*treedata);
+        searchIndex = std::make_unique<sst::jucegui::data::TreeSearchIndex>(*treedata);
+        filtereddata =
+            std::make_unique<sst::jucegui::data::FilteredTabularizedViewOfTree>(*searchIndex);
 
-        auto tt = std::make_unique<sst::jucegui::components::TabularizedTreeViewer>();
-        tt->setSource(tablularizeddata.get());
+        auto tt = std::make_unique<TreeWithHeader>();
+        tt->viewer.setSource(tablularizeddata.get());
+        viewer = &tt->viewer;
         panel->setContentAreaComponent(std::move(tt));
         addAndMakeVisible(*panel);
+
+        search = std::make_unique<juce::TextEditor>();
+        search->setTextToShowWhenEmpty("Search", juce::Colours::grey);
+        search->onTextChange = [this]() { updateSearch(); };
+        addAndMakeVisible(*search);
+
+        rescan = std::make_unique<juce::TextButton>("Rescan");
+        rescan->onClick = [this]() {
+            static_cast<FSTreeDataEntry *>(treedata->getRoot().get())->rescan();
+        };
+        addAndMakeVisible(*rescan);
+
+        // Index whatever has loaded a slice at a time, refining any open search as it grows
+        startTimerHz(30);
         runExample();
     }
+    ~TreeTableFileSystem() { stopTimer(); }
+
+    void updateSearch()
+    {
+        auto q = search->getText().toStdString();
+        if (q.empty())
+        {
+            viewer->setSource(tablularizeddata.get());
+        }
+        else
+        {
+            filtereddata->setQuery(q);
+            shownGeneration = searchIndex->getGeneration();
+            viewer->setSource(filtereddata.get());
+        }
+        if (auto h = viewer->findParentComponentOfClass<TreeWithHeader>())
+            h->header.repaint();
+    }
+
+    void timerCallback() override
+    {
+        searchIndex->indexSome(2000);
+        if (search->getText().isNotEmpty() && searchIndex->getGeneration() != shownGeneration)
+        {
+            filtereddata->refresh();
+            shownGeneration = searchIndex->getGeneration();
+        }
+    }
 
-    void resized() override { panel->setBounds(getLocalBounds().reduced(10)); }
+    void resized() override
+    {
+        auto b = getLocalBounds().reduced(10);
+        auto top = b.removeFromTop(24);
+        rescan->setBounds(top.removeFromRight(80));
+        search->setBounds(top.withTrimmedRight(4));
+        panel->setBounds(b.withTrimmedTop(4));
+    }
 
     void recurseTree(const std::unique_ptr<sst::jucegui::data::TreeTableData::Entry> &e, int depth,
                      int maxDepth)
@@ -139,7 +397,7 @@ struct TreeTableFileSystem : public sst::jucegui::components::WindowPanel
                     break;
                 }
                 DBGOUT(std::setw(5)
-                       << i << " " << std::string(r.depth * 3, '-') << "| " << nm << r.label);
+                       << i << " " << std::string(r.depth * 3, '-') << "| " << nm << r.getLabel());
             }
         };
 
@@ -0,0 +1,252 @@
+//
+// A headless check of the gesture replayer: builds a knob, a multi switch, a draggable
+// text value and a tree viewer, replays a fixed recording onto them and checks the
+// values the gestures should leave behind. The recording goes through toString and
+// fromString first, so the text form is covered too. Exits non zero on any mismatch,
+// so CI can run it.
+//
+//   sst-jucegui-gesture-replay [--print]
+//
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sst/jucegui/components/DraggableTextEditableValue.h>
+#include <sst/jucegui/components/GestureRecorder.h>
+#include <sst/jucegui/components/Knob.h>
+#include <sst/jucegui/components/MultiSwitch.h>
+#include <sst/jucegui/components/TabularizedTreeViewer.h>
+#include <sst/jucegui/components/WindowPanel.h>
+#include <sst/jucegui/data/TreeTable.h>
+
+#include "../component-demo/ExampleUtils.h"
+
+namespace
+{
+namespace comp = sst::jucegui::components;
+namespace data = sst::jucegui::data;
+
+struct Node : data::TreeTableData::Entry
+{
+    explicit Node(const std::string &l) : label(l) {}
+    Node &add(const std::string &l)
+    {
+        children.push_back(std::make_unique<Node>(l));
+        return static_cast<Node &>(*children.back());
+    }
+
+    bool hasChildren() const override { return !children.empty(); }
+    uint32_t getChildCount() const override { return children.size(); }
+    const std::unique_ptr<Entry> &getChildAt(uint32_t idx) override { return children[idx]; }
+    std::string getLabel() const override { return label; }
+
+    std::string label;
+    std::vector<std::unique_ptr<Entry>> children;
+};
+
+// root, with a, b (holding b1 and b2) and c under it
+struct Tree : data::TreeTableData
+{
+    Tree()
+    {
+        auto n = std::make_unique<Node>("root");
+        n->add("a");
+        auto &b = n->add("b");
+        b.add("b1");
+        b.add("b2");
+        n->add("c");
+        root = std::move(n);
+    }
+    const std::unique_ptr<Entry> &getRoot() const override { return root; }
+
+    std::unique_ptr<Entry> root;
+};
+
+struct Panel : comp::WindowPanel
+{
+    // Child indices, which are the first step of every recorded path
+    enum Child
+    {
+        KNOB,
+        SWITCH,
+        TEXT,
+        TREE
+    };
+
+    Panel() : switchData(4), treeView(tree)
+    {
+        textData.max = 100;
+
+        knob.setSource(&knobData);
+        knob.setBounds(0, 0, 40, 40);
+        addAndMakeVisible(knob);
+
+        multiSwitch.setSource(&switchData);
+        multiSwitch.setBounds(50, 0, 60, 80);
+        addAndMakeVisible(multiSwitch);
+
+        text.setSource(&textData);
+        text.setBounds(120, 0, 60, 20);
+        addAndMakeVisible(text);
+
+        viewer.setSource(&treeView);
+        viewer.setBounds(0, 100, 200, 200);
+        addAndMakeVisible(viewer);
+
+        setSize(200, 300);
+    }
+
+    ConcreteCM knobData, textData;
+    ConcreteMultiM switchData;
+    Tree tree;
+    data::ConcreteTabularizedViewOfTree treeView;
+
+    comp::Knob knob;
+    comp::MultiSwitch multiSwitch;
+    comp::DraggableTextEditableValue text;
+    comp::TabularizedTreeViewer viewer;
+};
+
+struct Builder
+{
+    comp::GestureRecording recording;
+    double timeMs{0};
+
+    comp::Gesture &add(comp::Gesture::Kind k, Panel::Child c, float x = 0, float y = 0)
+    {
+        comp::Gesture g;
+        g.kind = k;
+        g.timeMs = (timeMs += 16);
+        g.path = {(int)c};
+        g.x = x;
+        g.y = y;
+        recording.gestures.push_back(g);
+        return recording.gestures.back();
+    }
+    void click(Panel::Child c, float x, float y)
+    {
+        add(comp::Gesture::DOWN, c, x, y);
+        add(comp::Gesture::UP, c, x, y);
+    }
+    void key(Panel::Child c, int keyCode, uint32_t keyChar = 0, int mods = 0)
+    {
+        auto &g = add(comp::Gesture::KEY, c);
+        g.keyCode = keyCode;
+        g.keyChar = keyChar;
+        g.mods = mods;
+    }
+};
+
+comp::GestureRecording makeRecording()
+{
+    Builder b;
+
+    // A vertical drag moves the knob 1/150 per pixel: 15 pixels up twice is 0.2, and a
+    // wheel step of 0.1 on top makes 0.3
+    b.add(comp::Gesture::DOWN, Panel::KNOB, 20, 35);
+    b.add(comp::Gesture::DRAG, Panel::KNOB, 20, 20);
+    b.add(comp::Gesture::DRAG, Panel::KNOB, 20, 5);
+    b.add(comp::Gesture::UP, Panel::KNOB, 20, 5);
+    b.add(comp::Gesture::WHEEL, Panel::KNOB, 20, 5).wheelDeltaY = 0.1f;
+
+    // Four options in 80 pixels are 20 pixels each; a press in the top one and a drag to
+    // the third leaves 2
+    b.add(comp::Gesture::DOWN, Panel::SWITCH, 30, 10);
+    b.add(comp::Gesture::DRAG, Panel::SWITCH, 30, 50);
+    b.add(comp::Gesture::UP, Panel::SWITCH, 30, 50);
+
+    // Half a fine step (1% of the range) per pixel, so 20 pixels up on 0..100 is 10
+    b.add(comp::Gesture::DOWN, Panel::TEXT, 30, 10);
+    b.add(comp::Gesture::DRAG, Panel::TEXT, 30, 0);
+    b.add(comp::Gesture::DRAG, Panel::TEXT, 30, -10);
+    b.add(comp::Gesture::UP, Panel::TEXT, 30, -10);
+
+    // Open the root and then b on their toggles, step down to b1, then type ahead to c
+    b.click(Panel::TREE, 10, 9);
+    b.click(Panel::TREE, 30, 2 * 18 + 9);
+    b.key(Panel::TREE, juce::KeyPress::downKey);
+    b.key(Panel::TREE, 'c', 'c');
+
+    return b.recording;
+}
+
+/*
+ * Played after the first recording, with c selected and b open. Step up to b and close
+ * it, then alt+right starts streaming its subtree in and left closes it again before a
+ * frame has run. The frames after must not put b's children back under it.
+ */
+comp::GestureRecording makeCloseWhileExpanding()
+{
+    Builder b;
+    for (int i = 0; i < 3; ++i)
+        b.key(Panel::TREE, juce::KeyPress::upKey);
+    b.key(Panel::TREE, juce::KeyPress::leftKey);
+    b.key(Panel::TREE, juce::KeyPress::rightKey, 0, juce::ModifierKeys::altModifier);
+    b.key(Panel::TREE, juce::KeyPress::leftKey);
+    return b.recording;
+}
+
+bool check(const char *what, double value, double expected)
+{
+    auto ok = std::fabs(value - expected) < 1e-4;
+    std::cout << (ok ? "ok   " : "FAIL ") << what << " " << value << " expected " << expected
+              << "\n";
+    return ok;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    auto print = argc > 1 && std::string(argv[1]) == "--print";
+
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    sst::jucegui::style::StyleSheet::initializeStyleSheets([]() {});
+
+    namespace style = sst::jucegui::style;
+    auto panel = std::make_unique<Panel>();
+    panel->setStyle(style::StyleSheet::getBuiltInStyleSheet(style::StyleSheet::DARK));
+    panel->setSettings(std::make_shared<style::Settings>());
+
+    auto text = makeRecording().toString();
+    if (print)
+        std::cout << text;
+
+    comp::GestureRecording recording;
+    if (!recording.fromString(text))
+    {
+        std::cout << "FAIL recording does not parse\n";
+        return 1;
+    }
+
+    comp::GestureReplayer replayer(*panel);
+    auto stats = replayer.replay(recording);
+    std::cout << stats.getReport();
+
+    auto ok = true;
+    ok &= check("skipped events", stats.skipped, 0);
+    ok &= check("knob value", panel->knobData.getValue(), 0.3);
+    ok &= check("switch value", panel->switchData.getValue(), 2);
+    ok &= check("text value", panel->textData.getValue(), 10);
+    // root, a, b, b1, b2, c with c selected
+    ok &= check("tree rows", panel->treeView.getRowCount(), 6);
+    ok &= check("tree selection", panel->viewer.getSelectedRow(), 5);
+
+    auto closing = replayer.replay(makeCloseWhileExpanding());
+    while (panel->viewer.onFrame(0))
+        ;
+    using row_t = data::TabularizedTreeView::TabularizedRow;
+    const auto &view = panel->treeView;
+    ok &= check("skipped closing events", closing.skipped, 0);
+    // root, a, b and c, with b closed and c straight after it
+    ok &= check("tree rows after close", view.getRowCount(), 4);
+    ok &= check("closed row stays closed", view.getRow(2).type == row_t::CLOSED, 1);
+    ok &= check("row after closed row", view.getRow(3).depth, 1);
+
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+    return ok ? 0 : 1;
+}
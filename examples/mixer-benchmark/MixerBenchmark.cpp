@@ -0,0 +1,354 @@
+//
+// A headless scaling benchmark: builds the MixerPrototype channel strip N times and
+// drives randomized automation through setValueFromModel, reporting how construction,
+// heap use, notification and painting scale with N. Exits non zero when the per channel
+// cost at the largest N grows past --max-scaling times the cost at the smallest, or
+// past any absolute limit given, so CI can gate on it without a machine specific
+// baseline.
+//
+// Before the runs it resizes one channel through a fixed sequence and checks how much of
+// its LayoutTree was solved, walked and skipped, so the incremental layout is gated too.
+//
+//   sst-jucegui-mixer-benchmark --channels 16,256,4096 --rate 30 --frames 120
+//
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <sst/jucegui/components/WindowPanel.h>
+#include <sst/jucegui/util/HdrHistogram.h>
+
+#include "../component-demo/MixerPrototype.h"
+
+/*
+ * Count live heap bytes so we can say what a channel costs. Each block carries its size
+ * in a header; the header is max_align_t sized so the block stays aligned.
+ */
+namespace
+{
+std::atomic<int64_t> heapBytes{0};
+constexpr size_t headerSize{alignof(std::max_align_t)};
+} // namespace
+
+void *operator new(size_t n)
+{
+    auto p = static_cast<char *>(std::malloc(n + headerSize));
+    if (!p)
+        throw std::bad_alloc();
+    *reinterpret_cast<size_t *>(p) = n;
+    heapBytes.fetch_add((int64_t)n, std::memory_order_relaxed);
+    return p + headerSize;
+}
+void operator delete(void *p) noexcept
+{
+    if (!p)
+        return;
+    auto b = static_cast<char *>(p) - headerSize;
+    heapBytes.fetch_sub((int64_t)*reinterpret_cast<size_t *>(b), std::memory_order_relaxed);
+    std::free(b);
+}
+void *operator new[](size_t n) { return operator new(n); }
+void operator delete[](void *p) noexcept { operator delete(p); }
+void operator delete(void *p, size_t) noexcept { operator delete(p); }
+void operator delete[](void *p, size_t) noexcept { operator delete(p); }
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+double usSince(Clock::time_point t)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - t).count();
+}
+
+struct Options
+{
+    std::vector<int> channels{16, 64, 256, 1024, 4096};
+    double rate{30};  // automation updates per channel per second
+    double fps{60};   // frames per simulated second
+    int frames{120};  // automation frames per run
+    uint32_t seed{1234};
+    double maxScaling{3.0};
+    // Absolute limits at the largest N; zero leaves them unchecked
+    double maxConstructUs{0}, maxPaintUs{0}, maxNotifyNs{0}, maxFrameMs{0};
+};
+
+struct Result
+{
+    int channels{0};
+    double constructUsPerChannel{0}, bytesPerChannel{0};
+    double notifyNsPerUpdate{0}, paintUsPerChannel{0};
+    double fullPaintMs{0}, frameP50Ms{0}, frameP99Ms{0};
+};
+
+struct Mixer : sst::jucegui::components::WindowPanel
+{
+    static constexpr int channelWidth{40}, channelHeight{200}, columns{64};
+
+    explicit Mixer(int n)
+    {
+        channels.reserve(n);
+        for (int i = 0; i < n; ++i)
+        {
+            auto c = std::make_unique<MixerProto::Channel>(std::to_string(i));
+            c->setBounds((i % columns) * channelWidth, (i / columns) * channelHeight,
+                         channelWidth, channelHeight);
+            addAndMakeVisible(*c);
+            channels.push_back(std::move(c));
+        }
+        setSize(columns * channelWidth, (n + columns - 1) / columns * channelHeight);
+    }
+
+    std::vector<std::unique_ptr<MixerProto::Channel>> channels;
+};
+
+Result run(int n, const Options &o)
+{
+    namespace style = sst::jucegui::style;
+    Result res;
+    res.channels = n;
+    std::mt19937 rng(o.seed);
+    std::uniform_real_distribution<float> unit(0.f, 1.f);
+
+    auto heapBefore = heapBytes.load();
+    auto t0 = Clock::now();
+    auto mixer = std::make_unique<Mixer>(n);
+    mixer->setStyle(style::StyleSheet::getBuiltInStyleSheet(style::StyleSheet::DARK));
+    mixer->setSettings(std::make_shared<style::Settings>());
+    res.constructUsPerChannel = usSince(t0) / n;
+    res.bytesPerChannel = double(heapBytes.load() - heapBefore) / n;
+
+    // Channels paint one at a time into a strip sized image, so 4096 channels do not
+    // need a 4096 channel wide bitmap
+    juce::Image img(juce::Image::ARGB, Mixer::channelWidth, Mixer::channelHeight, true);
+    auto paintChannel = [&img](juce::Component &c) {
+        juce::Graphics g(img);
+        c.paintEntireComponent(g, false);
+    };
+
+    auto tp = Clock::now();
+    for (auto &c : mixer->channels)
+        paintChannel(*c);
+    res.fullPaintMs = usSince(tp) / 1000.0;
+
+    auto updatesPerFrame = std::max(1, (int)(o.rate * n / o.fps));
+    std::vector<char> dirty(n);
+    sst::jucegui::util::HdrHistogram<> frameUs;
+    double notifyUs{0}, paintUs{0};
+    uint64_t updates{0}, paints{0};
+
+    for (int f = 0; f < o.frames; ++f)
+    {
+        auto tf = Clock::now();
+        std::fill(dirty.begin(), dirty.end(), 0);
+        for (int u = 0; u < updatesPerFrame; ++u)
+        {
+            auto ci = (int)(rng() % n);
+            auto &c = *mixer->channels[ci];
+            switch (rng() % 8)
+            {
+            case 0:
+                c.muteBM.setValueFromModel(!c.muteBM.getValue());
+                break;
+            case 1:
+                c.soloBM.setValueFromModel(!c.soloBM.getValue());
+                break;
+            case 2:
+            case 3:
+                c.panCM.setValueFromModel(c.panCM.value01ToValue(unit(rng)));
+                break;
+            default:
+                c.levCM.setValueFromModel(unit(rng));
+                break;
+            }
+            dirty[ci] = 1;
+        }
+        auto tn = usSince(tf);
+        notifyUs += tn;
+        updates += updatesPerFrame;
+
+        auto tq = Clock::now();
+        for (int i = 0; i < n; ++i)
+        {
+            if (dirty[i])
+            {
+                paintChannel(*mixer->channels[i]);
+                paints++;
+            }
+        }
+        paintUs += usSince(tq);
+        frameUs.record((uint64_t)usSince(tf));
+    }
+
+    res.notifyNsPerUpdate = notifyUs * 1000.0 / std::max(updates, uint64_t(1));
+    res.paintUsPerChannel = paintUs / std::max(paints, uint64_t(1));
+    res.frameP50Ms = frameUs.valueAtPercentile(50) / 1000.0;
+    res.frameP99Ms = frameUs.valueAtPercentile(99) / 1000.0;
+    return res;
+}
+
+std::vector<int> parseList(const std::string &s)
+{
+    std::vector<int> res;
+    size_t pos{0};
+    while (pos < s.size())
+    {
+        auto e = s.find(',', pos);
+        if (e == std::string::npos)
+            e = s.size();
+        res.push_back(std::clamp(std::atoi(s.substr(pos, e - pos).c_str()), 1, 65536));
+        pos = e + 1;
+    }
+    return res;
+}
+
+bool parse(int argc, char **argv, Options &o)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string a = argv[i];
+        auto next = [&]() -> std::string { return i + 1 < argc ? argv[++i] : ""; };
+        if (a == "--channels")
+            o.channels = parseList(next());
+        else if (a == "--rate")
+            o.rate = std::atof(next().c_str());
+        else if (a == "--fps")
+            o.fps = std::max(1.0, std::atof(next().c_str()));
+        else if (a == "--frames")
+            o.frames = std::max(1, std::atoi(next().c_str()));
+        else if (a == "--seed")
+            o.seed = (uint32_t)std::atoi(next().c_str());
+        else if (a == "--max-scaling")
+            o.maxScaling = std::atof(next().c_str());
+        else if (a == "--max-construct-us")
+            o.maxConstructUs = std::atof(next().c_str());
+        else if (a == "--max-paint-us")
+            o.maxPaintUs = std::atof(next().c_str());
+        else if (a == "--max-notify-ns")
+            o.maxNotifyNs = std::atof(next().c_str());
+        else if (a == "--max-frame-ms")
+            o.maxFrameMs = std::atof(next().c_str());
+        else
+        {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--channels 16,64,...] [--rate updates/channel/s] [--fps n]"
+                         " [--frames n] [--seed n] [--max-scaling x] [--max-construct-us x]"
+                         " [--max-paint-us x] [--max-notify-ns x] [--max-frame-ms x]\n";
+            return false;
+        }
+    }
+    std::sort(o.channels.begin(), o.channels.end());
+    return !o.channels.empty();
+}
+
+bool check(const char *what, double value, double limit)
+{
+    if (limit <= 0 || value <= limit)
+        return true;
+    std::cout << "FAIL " << what << " " << value << " over " << limit << "\n";
+    return false;
+}
+
+bool checkLayout()
+{
+    MixerProto::Channel c("0");
+    const auto &stats = c.layout.stats;
+    auto ok = true;
+    auto expect = [&](const char *what, uint64_t solved, uint64_t descended, uint64_t skipped) {
+        auto good = stats.solved == solved && stats.translated == 0 &&
+                    stats.descended == descended && stats.skipped == skipped;
+        if (!good)
+            std::cout << "FAIL layout " << what << ": solved " << stats.solved << " translated "
+                      << stats.translated << " descended " << stats.descended << " skipped "
+                      << stats.skipped << "\n";
+        ok &= good;
+    };
+
+    // Both nodes solve the first time
+    c.setSize(40, 200);
+    expect("first resize", 2, 0, 0);
+    // Taller: only the strip solves, the buttons are where they were
+    c.setSize(40, 300);
+    expect("taller", 3, 0, 1);
+    // Wider: the square pan track changes with the width, and the buttons widen
+    c.setSize(50, 300);
+    expect("wider", 5, 0, 1);
+    // An edit below the strip walks the strip without solving it
+    c.buttonsNode->invalidate();
+    c.resized();
+    expect("buttons invalidated", 6, 1, 1);
+    c.resized();
+    expect("unchanged", 6, 1, 2);
+
+    // The same rectangles the hand written resized() gave
+    auto bounds = [&](const char *what, juce::Component &comp, juce::Rectangle<int> r) {
+        if (comp.getBounds() == r)
+            return;
+        std::cout << "FAIL layout " << what << " bounds\n";
+        ok = false;
+    };
+    bounds("solo", *c.solo, {1, 1, 23, 18});
+    bounds("mute", *c.mute, {26, 1, 23, 18});
+    bounds("pan", *c.pan, {0, 22, 50, 50});
+    bounds("level", *c.level, {0, 74, 50, 209});
+    bounds("label", *c.lab, {0, 283, 50, 17});
+    return ok;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options o;
+    if (!parse(argc, argv, o))
+        return 2;
+
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    sst::jucegui::style::StyleSheet::initializeStyleSheets([]() {});
+
+    auto layoutOk = checkLayout();
+
+    std::vector<Result> results;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "channels  construct-us/ch  bytes/ch  notify-ns/upd  paint-us/ch  "
+                 "full-paint-ms  frame-p50-ms  frame-p99-ms\n";
+    for (auto n : o.channels)
+    {
+        auto r = run(n, o);
+        std::cout << std::setw(8) << r.channels << std::setw(17) << r.constructUsPerChannel
+                  << std::setw(10) << r.bytesPerChannel << std::setw(15) << r.notifyNsPerUpdate
+                  << std::setw(13) << r.paintUsPerChannel << std::setw(15) << r.fullPaintMs
+                  << std::setw(14) << r.frameP50Ms << std::setw(14) << r.frameP99Ms << "\n";
+        results.push_back(r);
+    }
+
+    const auto &lo = results.front(), &hi = results.back();
+    auto ok = layoutOk;
+    if (results.size() > 1)
+    {
+        auto ratio = [](double a, double b) { return b > 0 ? a / b : 1.0; };
+        ok &= check("construct scaling", ratio(hi.constructUsPerChannel, lo.constructUsPerChannel),
+                    o.maxScaling);
+        ok &= check("memory scaling", ratio(hi.bytesPerChannel, lo.bytesPerChannel), o.maxScaling);
+        ok &= check("notify scaling", ratio(hi.notifyNsPerUpdate, lo.notifyNsPerUpdate),
+                    o.maxScaling);
+        ok &= check("paint scaling", ratio(hi.paintUsPerChannel, lo.paintUsPerChannel),
+                    o.maxScaling);
+    }
+    ok &= check("construct us/channel", hi.constructUsPerChannel, o.maxConstructUs);
+    ok &= check("paint us/channel", hi.paintUsPerChannel, o.maxPaintUs);
+    ok &= check("notify ns/update", hi.notifyNsPerUpdate, o.maxNotifyNs);
+    ok &= check("frame p99 ms", hi.frameP99Ms, o.maxFrameMs);
+
+    std::cout << (ok ? "PASS" : "FAIL") << "\n";
+    return ok ? 0 : 1;
+}
@@ -20,6 +20,9 @@
 
 #include <functional>
 #include <juce_gui_basics/juce_gui_basics.h>
+#include <sst/jucegui/util/Footprint.h>
+
+#include "PaintProfiler.h"
 
 namespace sst::jucegui::components
 {
@@ -40,22 +43,31 @@ template <typename T> struct CallbackButtonComponent : public juce::Component
 
     void mouseEnter(const juce::MouseEvent &e) override
     {
+        SST_JUCEGUI_PROFILE_SCOPE_FOR(asT(), "mouseEnter");
         asT()->startHover();
         asT()->repaint();
     }
     void mouseExit(const juce::MouseEvent &e) override
     {
+        SST_JUCEGUI_PROFILE_SCOPE_FOR(asT(), "mouseExit");
         asT()->endHover();
         asT()->repaint();
     }
 
     void mouseDown(const juce::MouseEvent &e) override
     {
+        SST_JUCEGUI_PROFILE_SCOPE_FOR(asT(), "mouseDown");
         if (onCB)
             onCB();
     }
 
   protected:
+    void describeCallbackFootprint(util::Footprint &f) const
+    {
+        f.addInline("onCB", sizeof(onCB));
+        f.addHeap("label", util::heapBytesOf(label));
+    }
+
     std::string label;
     bool isInactive{false};
     std::function<void()> onCB{nullptr};
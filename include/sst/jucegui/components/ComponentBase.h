@@ -18,9 +18,14 @@
 #ifndef INCLUDE_SST_JUCEGUI_COMPONENTS_COMPONENTBASE_H
 #define INCLUDE_SST_JUCEGUI_COMPONENTS_COMPONENTBASE_H
 
-#include <functional>
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <sst/jucegui/data/Continuous.h>
+#include <sst/jucegui/data/Discrete.h>
+#include <sst/jucegui/data/EditJournal.h>
+#include <sst/jucegui/util/Footprint.h>
+#include <sst/jucegui/util/InlineCallback.h>
+
+#include "PaintProfiler.h"
 
 namespace sst::jucegui::components
 {
@@ -28,10 +33,13 @@ template <typename T> struct EditableComponentBase
 {
     EditableComponentBase() = default;
 
-    std::function<void(void)> onBeginEdit = []() {};
-    std::function<void(void)> onEndEdit = []() {};
-    std::function<void(const juce::ModifierKeys &m)> onPopupMenu = [](const juce::ModifierKeys &m) {
-    };
+    /*
+     * Assign lambdas to these as you would to a std::function. Unset, they do nothing,
+     * and small captures are stored in the widget rather than on the heap.
+     */
+    util::InlineCallback<void()> onBeginEdit;
+    util::InlineCallback<void()> onEndEdit;
+    util::InlineCallback<void(const juce::ModifierKeys &m)> onPopupMenu;
 
     T *asT() { return static_cast<T *>(this); }
 
@@ -46,10 +54,57 @@ template <typename T> struct EditableComponentBase
         asT()->repaint();
     }
 
+    /*
+     * Attach an undo journal. Editors then record each gesture into it; the journal
+     * must outlive the component.
+     */
+    void setEditJournal(data::EditJournal *j) { editJournal = j; }
+    data::EditJournal *getEditJournal() const { return editJournal; }
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EditableComponentBase<T>);
 
   protected:
     bool isHovered{false};
+
+    // Use these rather than calling onBeginEdit / onEndEdit directly so gestures reach
+    // the journal
+    void beginEdit()
+    {
+        if (editJournal)
+            editJournal->beginGesture();
+        onBeginEdit();
+    }
+    void endEdit()
+    {
+        onEndEdit();
+        if (editJournal)
+            editJournal->endGesture();
+    }
+    void setValueFromGUIJournaled(data::Continuous *s, float v)
+    {
+        if (editJournal)
+            editJournal->recordEdit(s, s->getValue(), v);
+        s->setValueFromGUI(v);
+    }
+    void setValueFromGUIJournaled(data::Discrete *s, int v)
+    {
+        if (editJournal)
+            editJournal->recordEdit(s, s->getValue(), v);
+        s->setValueFromGUI(v);
+    }
+
+    // For the describeFootprint of components built on this
+    void describeEditableFootprint(util::Footprint &f) const
+    {
+        f.addInline("onBeginEdit", sizeof(onBeginEdit));
+        f.addInline("onEndEdit", sizeof(onEndEdit));
+        f.addInline("onPopupMenu", sizeof(onPopupMenu));
+        f.addHeap("onBeginEdit", onBeginEdit.heapBytes());
+        f.addHeap("onEndEdit", onEndEdit.heapBytes());
+        f.addHeap("onPopupMenu", onPopupMenu.heapBytes());
+    }
+
+    data::EditJournal *editJournal{nullptr};
 };
 
 template <typename T> struct Modulatable : public data::Continuous::DataListener
@@ -89,10 +144,12 @@ template <typename T> struct Modulatable : public data::Continuous::DataListener
         source = s;
         if (source)
             source->addGUIDataListener(this);
+        onSourceChanged();
         asT()->repaint();
     }
 
     void dataChanged() override { asT()->repaint(); }
+    virtual void onSourceChanged() {}
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Modulatable<T>);
 
@@ -0,0 +1,58 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_COMPONENTS_COMPONENTFOOTPRINT_H
+#define INCLUDE_SST_JUCEGUI_COMPONENTS_COMPONENTFOOTPRINT_H
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <string>
+#include <vector>
+#include <sst/jucegui/util/Footprint.h>
+
+namespace sst::jucegui::components
+{
+/*
+ * The footprint of one component: the object its StyleConsumer::describeFootprintObject
+ * names and the parts its describeFootprint adds, or just sizeof(juce::Component) for
+ * components which are not style consumers, plus the pointers to its children.
+ */
+util::Footprint footprintOf(const juce::Component &c);
+
+/*
+ * Footprints summed over root and everything under it, grouped by type name with the
+ * most expensive type first. Multiply by the editors open in a session for what the
+ * widgets cost a host.
+ */
+struct TreeFootprint
+{
+    struct TypeTotal
+    {
+        std::string typeName;
+        size_t count{0}, objectBytes{0}, heapBytes{0};
+        size_t totalBytes() const { return objectBytes + heapBytes; }
+    };
+    std::vector<TypeTotal> byType;
+    size_t components{0}, objectBytes{0}, heapBytes{0};
+
+    size_t totalBytes() const { return objectBytes + heapBytes; }
+    std::string getReport() const;
+};
+
+TreeFootprint footprintOfTree(const juce::Component &root);
+} // namespace sst::jucegui::components
+
+#endif // SST_JUCEGUI_COMPONENTFOOTPRINT_H
@@ -27,13 +27,15 @@
 
 #include "ComponentBase.h"
 #include "BaseStyles.h"
+#include "FrameScheduler.h"
 
 namespace sst::jucegui::components
 {
 struct ContinuousParamEditor : public juce::Component,
                                public Modulatable<ContinuousParamEditor>,
                                public EditableComponentBase<ContinuousParamEditor>,
-                               public style::SettingsConsumer
+                               public style::SettingsConsumer,
+                               public FrameScheduler::Client
 {
     struct Styles : GraphicalControlStyles
     {
@@ -68,9 +70,107 @@ struct ContinuousParamEditor : public juce::Component,
     void mouseEnter(const juce::MouseEvent &e) override { startHover(); }
     void mouseExit(const juce::MouseEvent &e) override { endHover(); }
 
+    void dataChanged() override;
+    void onSourceChanged() override;
+    bool onFrame(double nowMs) override;
+    void visibilityChanged() override { wakeForModulation(); }
+    void parentHierarchyChanged() override { wakeForModulation(); }
+
+    /*
+     * The value subclasses should draw. This is the source value, unless the source
+     * asked for display smoothing and we are gliding between model updates.
+     */
+    float getDisplayValue01();
+
+    /*
+     * If the source has a live modulation feed, copy up to n modulated values spread
+     * over the feed history (0..1, oldest first, current value last) into `into` and
+     * return how many.
+     */
+    static constexpr int liveModulationTrailLength{8};
+    int getLiveModulationTrail(float *into, int n);
+
+    /*
+     * Draw the live modulation trail as fading dots at pointFor01(value), the newest
+     * last and most opaque.
+     */
+    template <typename F>
+    void paintLiveModulation(juce::Graphics &g, const juce::Colour &c, float radius, F &&pointFor01)
+    {
+        float trail[liveModulationTrailLength];
+        auto n = getLiveModulationTrail(trail, liveModulationTrailLength);
+        for (int i = 0; i < n; ++i)
+        {
+            auto p = pointFor01(trail[i]);
+            g.setColour(c.withAlpha((i + 1.f) / n));
+            g.fillEllipse(p.x - radius, p.y - radius, 2 * radius, 2 * radius);
+        }
+    }
+
   protected:
+    // The parts every editor shares, for the describeFootprint of subclasses
+    void describeEditorFootprint(util::Footprint &f) const;
+
     float mouseDownV0, mouseDownX0, mouseDownY0;
 
+    /*
+     * Interpolates the displayed position between time stamped model updates,
+     * gliding over the observed update interval (capped by the source smoothing time)
+     * so the glide finishes about as the next update arrives.
+     */
+    struct DisplayInterpolator
+    {
+        float from{0}, to{0};
+        double startMs{0}, durationMs{0}, lastUpdateMs{-1};
+
+        void retarget(float v, double nowMs, double maxDurationMs)
+        {
+            if (lastUpdateMs < 0)
+            {
+                // nothing to glide from on the first update
+                from = to = v;
+                lastUpdateMs = nowMs;
+                return;
+            }
+            from = valueAt(nowMs);
+            to = v;
+            durationMs = std::clamp(nowMs - lastUpdateMs, 0., maxDurationMs);
+            startMs = nowMs;
+            lastUpdateMs = nowMs;
+        }
+        float valueAt(double nowMs) const
+        {
+            if (durationMs <= 0 || nowMs >= startMs + durationMs)
+                return to;
+            return from + (to - from) * (float)((nowMs - startMs) / durationMs);
+        }
+        bool isSettled(double nowMs) const { return nowMs >= startMs + durationMs; }
+    } displayInterpolator;
+    bool displayAnimating{false};
+    uint32_t lastDrawnModulationCount{0};
+
+    /*
+     * An editor only takes frames for its live modulation feed while the feed moves and
+     * the editor is showing. A quiet shown one sleeps, and one shared frame client wakes
+     * it when a push bumps LiveModulationFeed's wake sequence. A hidden one is off that
+     * path, so pushes to it cost nothing, until a ShowWatcher hears it shown.
+     */
+    struct ModulationWaker;
+    struct ShowWatcher;
+    void wakeForModulation();
+    bool sleepForModulation(const data::LiveModulationFeed *feed);
+    bool modulationAsleep{false};
+    std::unique_ptr<ShowWatcher> showWatcher;
+
+    // Edits made here jump to the new value; only changes from elsewhere glide
+    void setValueFromEditor(float v)
+    {
+        settingValue = true;
+        setValueFromGUIJournaled(source, v);
+        settingValue = false;
+    }
+    bool settingValue{false};
+
     enum MouseMode
     {
         NONE,
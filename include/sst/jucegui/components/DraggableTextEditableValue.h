@@ -54,6 +54,8 @@ struct DraggableTextEditableValue : public juce::Component,
     DraggableTextEditableValue();
 
     void paint(juce::Graphics &g) override;
+    void describeFootprint(util::Footprint &f) const override;
+    SST_JUCEGUI_DECLARE_FOOTPRINT(DraggableTextEditableValue, Styles::styleClass.cname);
     void resized() override;
 
     void mouseDown(const juce::MouseEvent &e) override;
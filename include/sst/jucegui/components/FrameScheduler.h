@@ -0,0 +1,71 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_COMPONENTS_FRAMESCHEDULER_H
+#define INCLUDE_SST_JUCEGUI_COMPONENTS_FRAMESCHEDULER_H
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <sst/jucegui/util/SmallListenerList.h>
+
+namespace sst::jucegui::components
+{
+/**
+ * The FrameScheduler is a single program wide timer which drives any component
+ * which needs to animate. Rather than each widget running its own juce::Timer,
+ * a widget which needs frames calls `requestFrames(this)` and gets an `onFrame`
+ * callback at the frame rate until it returns false, at which point it is
+ * dropped. When no client wants frames the timer stops.
+ *
+ * The scheduler is created on first request and deleted at shutdown. Use the
+ * static `cancelFrames` from destructors; it never creates the scheduler.
+ */
+struct FrameScheduler : private juce::Timer, private juce::DeletedAtShutdown
+{
+    struct Client
+    {
+        virtual ~Client() = default;
+        /*
+         * Called once per frame on the message thread with the frame time in
+         * milliseconds. Return false when no further frames are needed.
+         */
+        virtual bool onFrame(double nowMs) = 0;
+    };
+
+    static FrameScheduler &getInstance();
+    static void cancelFrames(Client *c);
+
+    void requestFrames(Client *c);
+
+    void setFrameRateHz(int hz);
+    int getFrameRateHz() const { return frameRateHz; }
+
+    static double nowMs() { return juce::Time::getMillisecondCounterHiRes(); }
+
+  private:
+    FrameScheduler() = default;
+    ~FrameScheduler();
+
+    void timerCallback() override;
+
+    int frameRateHz{60};
+    util::SmallListenerList<Client, 8> clients;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FrameScheduler);
+};
+} // namespace sst::jucegui::components
+
+#endif // SST_JUCEGUI_FRAMESCHEDULER_H
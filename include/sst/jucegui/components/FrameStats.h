@@ -0,0 +1,115 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_COMPONENTS_FRAMESTATS_H
+#define INCLUDE_SST_JUCEGUI_COMPONENTS_FRAMESTATS_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+#include <sst/jucegui/util/HdrHistogram.h>
+
+namespace sst::jucegui::components
+{
+/**
+ * Frame time statistics for QA runs and for catching jank in a running editor. Create
+ * one and make it active with setActive; while it is, the outermost WindowPanel reports
+ * each frame it paints (from the start of its paint to the end of its paintOverChildren,
+ * so all of its children are inside) and the FrameScheduler reports every client it
+ * drives as a repaint request towards the next frame. Histograms of frame duration,
+ * paints per frame and repaint requests per frame give the p50 and p99 in getReport.
+ *
+ * A frame longer than the budget is kept as a SlowFrame naming the style classes which
+ * painted in it, slowest first, and handed to onSlowFrame. The per component paints come
+ * from the same instrumentation as the PaintProfiler, so paints per frame and the names
+ * need an SST_JUCEGUI_PROFILE build; frame times and repaint requests do not.
+ *
+ * Everything here runs on the message thread. With no FrameStats active the hooks cost
+ * one atomic load.
+ */
+struct FrameStats
+{
+    struct Painter
+    {
+        std::string styleClass;
+        int count{0};
+        int64_t durationUs{0};
+    };
+    struct SlowFrame
+    {
+        uint64_t frame{0};
+        int64_t durationUs{0};
+        uint32_t paints{0}, repaintRequests{0};
+        std::vector<Painter> painters;
+    };
+
+    explicit FrameStats(double budgetMs = 1000.0 / 60.0);
+    ~FrameStats();
+
+    static void setActive(FrameStats *fs) { active = fs; }
+    static FrameStats *getActive() { return active.load(std::memory_order_relaxed); }
+
+    void setBudgetMs(double ms) { budgetUs = (int64_t)(ms * 1000.0); }
+    double getBudgetMs() const { return budgetUs / 1000.0; }
+
+    // Called by the top level WindowPanel around each paint
+    void beginFrame();
+    void endFrame();
+    // styleClass must outlive the frame; style class names are string literals
+    void notePaint(const char *styleClass, int64_t durationUs);
+    void noteRepaintRequest() { repaintsThisFrame++; }
+
+    util::HdrHistogram<> frameUs, paintsPerFrame, repaintsPerFrame;
+
+    uint64_t getFrameCount() const { return frameUs.count(); }
+    uint64_t getSlowFrameCount() const { return slowFrameCount; }
+    // The latest maxSlowFramesKept slow frames, oldest first
+    const std::deque<SlowFrame> &getSlowFrames() const { return slowFrames; }
+    static constexpr size_t maxSlowFramesKept{32};
+
+    std::function<void(const SlowFrame &)> onSlowFrame;
+
+    std::string getReport(size_t paintersPerSlowFrame = 5) const;
+    void reset();
+
+    static int64_t nowUs();
+
+  private:
+    static inline std::atomic<FrameStats *> active{nullptr};
+
+    struct FramePainter
+    {
+        const char *styleClass;
+        int count;
+        int64_t durationUs;
+    };
+
+    int64_t budgetUs;
+    bool inFrame{false};
+    int64_t frameStartUs{0};
+    uint32_t paintsThisFrame{0}, repaintsThisFrame{0};
+    std::vector<FramePainter> paintersThisFrame;
+
+    uint64_t slowFrameCount{0};
+    std::deque<SlowFrame> slowFrames;
+};
+} // namespace sst::jucegui::components
+
+#endif // SST_JUCEGUI_FRAMESTATS_H
@@ -0,0 +1,151 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_COMPONENTS_GESTURERECORDER_H
+#define INCLUDE_SST_JUCEGUI_COMPONENTS_GESTURERECORDER_H
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <sst/jucegui/util/HdrHistogram.h>
+
+namespace sst::jucegui::components
+{
+/*
+ * One recorded input event. The target is named by the child indices leading to it
+ * from the root the recorder was attached to, and the position is in the target's
+ * coordinates, so a recording replays onto any identically built tree.
+ */
+struct Gesture
+{
+    enum Kind : uint8_t
+    {
+        DOWN,
+        DRAG,
+        UP,
+        MOVE,
+        ENTER,
+        EXIT,
+        DOUBLE_CLICK,
+        WHEEL,
+        KEY
+    };
+    Kind kind{MOVE};
+    double timeMs{0}; // since the recording started
+    std::vector<int> path;
+    float x{0}, y{0};
+    int mods{0}; // juce::ModifierKeys raw flags
+    int clicks{1};
+    float wheelDeltaX{0}, wheelDeltaY{0};
+    bool wheelReversed{false}, wheelSmooth{false};
+    int keyCode{0};
+    uint32_t keyChar{0};
+};
+
+struct GestureRecording
+{
+    std::vector<Gesture> gestures;
+
+    // One gesture per line, whitespace separated; stable enough to check in
+    std::string toString() const;
+    // Returns false, leaving the recording empty, if any line does not parse
+    bool fromString(const std::string &s);
+};
+
+/**
+ * Records the mouse and key events reaching a component tree: down, drag, up, move,
+ * enter, exit, double click and wheel for every component under root, and key presses
+ * for every component which wants keyboard focus at the time start() is called, once
+ * each, against the innermost of those holding focus. The recorder only listens, so the
+ * components behave as they would without it.
+ */
+struct GestureRecorder : juce::MouseListener, juce::KeyListener
+{
+    explicit GestureRecorder(juce::Component &root);
+    ~GestureRecorder() override;
+
+    void start();
+    void stop();
+    bool isRecording() const { return recording; }
+
+    const GestureRecording &getRecording() const { return result; }
+
+    void mouseDown(const juce::MouseEvent &e) override { add(Gesture::DOWN, e); }
+    void mouseDrag(const juce::MouseEvent &e) override { add(Gesture::DRAG, e); }
+    void mouseUp(const juce::MouseEvent &e) override { add(Gesture::UP, e); }
+    void mouseMove(const juce::MouseEvent &e) override { add(Gesture::MOVE, e); }
+    void mouseEnter(const juce::MouseEvent &e) override { add(Gesture::ENTER, e); }
+    void mouseExit(const juce::MouseEvent &e) override { add(Gesture::EXIT, e); }
+    void mouseDoubleClick(const juce::MouseEvent &e) override { add(Gesture::DOUBLE_CLICK, e); }
+    void mouseWheelMove(const juce::MouseEvent &e, const juce::MouseWheelDetails &w) override;
+    bool keyPressed(const juce::KeyPress &key, juce::Component *origin) override;
+
+  private:
+    // nullptr when not recording
+    Gesture *add(Gesture::Kind k, const juce::MouseEvent &e);
+    std::vector<int> pathTo(juce::Component *c) const;
+    // A key reaches every listened to ancestor of the focus; record it only once
+    bool isDeepestKeyTarget(juce::Component *origin) const;
+
+    juce::Component &root;
+    std::vector<juce::Component::SafePointer<juce::Component>> keyTargets;
+    bool recording{false};
+    double startMs{0};
+    GestureRecording result;
+};
+
+/**
+ * Replays a recording headlessly by building juce::MouseEvents and KeyPresses and calling
+ * the handlers of the recorded targets directly, with no peer, no OS events and no
+ * message loop. Events carry the recorded times, so a replay is deterministic, but are
+ * sent as fast as the handlers take them; the statistics are the handler times.
+ *
+ * A key goes to its target and then up the parents until one consumes it, as JUCE does.
+ * Events whose path no longer resolves are skipped and counted.
+ */
+struct GestureReplayer
+{
+    explicit GestureReplayer(juce::Component &root) : root(root) {}
+
+    struct Stats
+    {
+        uint64_t events{0}, skipped{0};
+        double wallMs{0};
+        // Handler times in nanoseconds
+        util::HdrHistogram<> allNs, dragNs;
+
+        double eventsPerSecond() const { return wallMs > 0 ? events * 1000.0 / wallMs : 0; }
+        std::string getReport() const;
+    };
+
+    Stats replay(const GestureRecording &r);
+    // Sends one gesture and returns false if its target is gone
+    bool dispatch(const Gesture &g);
+
+    juce::Component *resolve(const std::vector<int> &path) const;
+
+  private:
+    juce::Component &root;
+    juce::Time baseTime;
+    juce::Point<float> downPosition;
+    juce::Time downTime;
+    bool dragged{false};
+};
+} // namespace sst::jucegui::components
+
+#endif // SST_JUCEGUI_GESTURERECORDER_H
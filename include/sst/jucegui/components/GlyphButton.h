@@ -56,6 +56,8 @@ struct GlyphButton : public CallbackButtonComponent<GlyphButton>,
 
     int glyphButtonPad{0};
     void paint(juce::Graphics &g) override;
+    void describeFootprint(util::Footprint &f) const override;
+    SST_JUCEGUI_DECLARE_FOOTPRINT(GlyphButton, Styles::styleClass.cname);
     GlyphPainter::GlyphType glyph;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GlyphButton);
@@ -23,6 +23,7 @@
 #include <sst/jucegui/style/StyleAndSettingsConsumer.h>
 #include <sst/jucegui/style/StyleSheet.h>
 #include "BaseStyles.h"
+#include "PaintProfiler.h"
 
 namespace sst::jucegui::components
 {
@@ -60,6 +61,7 @@ struct GlyphPainter : public juce::Component,
 
     GlyphPainter(GlyphType g) : glyph(g), style::StyleConsumer(Styles::styleClass) {}
     void paint(juce::Graphics &) override;
+    SST_JUCEGUI_DECLARE_FOOTPRINT(GlyphPainter, Styles::styleClass.cname);
 
     /*
      * This class is both a component which can paint glyphs bit
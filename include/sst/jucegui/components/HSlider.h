@@ -44,6 +44,8 @@ struct HSlider : public ContinuousParamEditor, public style::StyleConsumer
     ~HSlider();
 
     void paint(juce::Graphics &g) override;
+    void describeFootprint(util::Footprint &f) const override;
+    SST_JUCEGUI_DECLARE_FOOTPRINT(HSlider, Styles::styleClass.cname);
 
     void setShowLabel(bool b)
     {
@@ -27,6 +27,7 @@ struct HSliderFilled : public HSlider
     HSliderFilled();
 
     void paint(juce::Graphics &g) override;
+    SST_JUCEGUI_DECLARE_FOOTPRINT(HSliderFilled, "hsliderfilled");
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HSliderFilled);
 };
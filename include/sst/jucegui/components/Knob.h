@@ -44,6 +44,8 @@ struct Knob : public ContinuousParamEditor, public style::StyleConsumer
     ~Knob();
 
     void paint(juce::Graphics &g) override;
+    void describeFootprint(util::Footprint &f) const override;
+    SST_JUCEGUI_DECLARE_FOOTPRINT(Knob, Styles::styleClass.cname);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Knob);
 };
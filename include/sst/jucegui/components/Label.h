@@ -23,6 +23,8 @@
 #include <sst/jucegui/style/StyleAndSettingsConsumer.h>
 #include <sst/jucegui/style/StyleSheet.h>
 
+#include "PaintProfiler.h"
+
 namespace sst::jucegui::components
 {
 struct Label : public juce::Component, public style::StyleConsumer, public style::SettingsConsumer
@@ -58,11 +60,19 @@ struct Label : public juce::Component, public style::StyleConsumer, public style
 
     void paint(juce::Graphics &g) override
     {
+        SST_JUCEGUI_PROFILE_SCOPE("paint");
         g.setColour(getColour(Styles::controlLabelCol));
         g.setFont(getFont(Styles::controlLabelFont));
         g.drawText(text, getLocalBounds(), justification);
     }
 
+    void describeFootprint(util::Footprint &f) const override
+    {
+        StyleConsumer::describeFootprint(f);
+        f.addHeap("text", util::heapBytesOf(text));
+    }
+    SST_JUCEGUI_DECLARE_FOOTPRINT(Label, Styles::styleClass.cname);
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Label);
 
   private:
@@ -55,6 +55,8 @@ struct MenuButton : public CallbackButtonComponent<MenuButton>,
     };
 
     void paint(juce::Graphics &g) override;
+    void describeFootprint(util::Footprint &f) const override;
+    SST_JUCEGUI_DECLARE_FOOTPRINT(MenuButton, Styles::styleClass.cname);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MenuButton);
 };
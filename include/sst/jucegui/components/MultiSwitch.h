@@ -70,6 +70,7 @@ struct MultiSwitch : public juce::Component,
 
     void mouseEnter(const juce::MouseEvent &e) override
     {
+        SST_JUCEGUI_PROFILE_SCOPE("mouseEnter");
         hoverX = e.x;
         hoverY = e.y;
         startHover();
@@ -77,6 +78,7 @@ struct MultiSwitch : public juce::Component,
     }
     void mouseExit(const juce::MouseEvent &e) override
     {
+        SST_JUCEGUI_PROFILE_SCOPE("mouseExit");
         endHover();
         repaint();
     }
@@ -87,6 +89,8 @@ struct MultiSwitch : public juce::Component,
     void mouseUp(const juce::MouseEvent &e) override;
 
     void paint(juce::Graphics &g) override;
+    void describeFootprint(util::Footprint &f) const override;
+    SST_JUCEGUI_DECLARE_FOOTPRINT(MultiSwitch, Styles::styleClass.cname);
 
     void setElementSize(int i) {
         elementSize = i;
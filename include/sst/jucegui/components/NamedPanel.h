@@ -25,6 +25,7 @@
 #include <sst/jucegui/style/StyleAndSettingsConsumer.h>
 #include <sst/jucegui/style/StyleSheet.h>
 #include "BaseStyles.h"
+#include "PaintProfiler.h"
 
 namespace sst::jucegui::components
 {
@@ -56,6 +57,8 @@ struct NamedPanel : public juce::Component,
     ~NamedPanel();
 
     void paint(juce::Graphics &g) override;
+    void describeFootprint(util::Footprint &f) const override;
+    SST_JUCEGUI_DECLARE_FOOTPRINT(NamedPanel, Styles::styleClass.cname);
     void resized() override;
 
     juce::Rectangle<int> getContentArea();
@@ -101,6 +104,13 @@ struct NamedPanel : public juce::Component,
   protected:
     std::string name;
     std::unique_ptr<juce::Component> contentAreaComp;
+
+  private:
+    // Tab widths as last measured, so resetTabState only measures names or fonts which
+    // changed
+    std::vector<std::string> measuredTabNames;
+    std::vector<int> measuredTabWidths;
+    juce::Font measuredFont;
 };
 } // namespace sst::jucegui::components
 
@@ -0,0 +1,102 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_COMPONENTS_PAINTPROFILER_H
+#define INCLUDE_SST_JUCEGUI_COMPONENTS_PAINTPROFILER_H
+
+#ifndef SST_JUCEGUI_PROFILE
+#define SST_JUCEGUI_PROFILE 0
+#endif
+
+#if SST_JUCEGUI_PROFILE
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+#include <sst/jucegui/style/StyleAndSettingsConsumer.h>
+
+namespace sst::jucegui::components
+{
+/*
+ * An opt in record of the time each component spends in paint, resized and its mouse
+ * handlers, tagged with its style class, for finding which widget blows the frame budget
+ * in a running host without attaching a profiler. Build with SST_JUCEGUI_PROFILE=1 (the
+ * CMake option of the same name); otherwise SST_JUCEGUI_PROFILE_SCOPE expands to nothing
+ * and none of this is compiled.
+ *
+ * Each thread records into a ring of its latest eventsPerThread events which only it
+ * writes, so recording takes no locks. writeChromeTrace dumps every ring as Chrome trace
+ * event JSON for chrome://tracing or ui.perfetto.dev. Events a thread overwrites while
+ * the dump reads them are left out rather than reported half written.
+ */
+struct PaintProfiler
+{
+    static constexpr uint64_t eventsPerThread{8192};
+    static constexpr size_t classNameLength{32};
+
+    struct Event
+    {
+        const char *what;
+        char styleClass[classNameLength];
+        int64_t startUs, durationUs;
+    };
+
+    static int64_t nowUs();
+    // what must be a string literal; styleClass is copied
+    static void record(const char *styleClass, const char *what, int64_t startUs,
+                       int64_t endUs);
+
+    static void writeChromeTrace(std::ostream &os);
+    // Forget everything recorded so far, on every thread
+    static void clear();
+
+    struct Scope
+    {
+        Scope(const char *sc, const char *w) : styleClass(sc), what(w), startUs(nowUs()) {}
+        ~Scope() { record(styleClass, what, startUs, nowUs()); }
+
+        const char *styleClass, *what;
+        int64_t startUs;
+    };
+};
+
+/*
+ * Resolved at run time, so a handler in a base which is not a StyleConsumer itself, such
+ * as ContinuousParamEditor under a Knob, is tagged with the widget it is part of
+ */
+template <typename T> const char *profileClassName(const T *c)
+{
+    if constexpr (std::is_polymorphic_v<T>)
+    {
+        if (auto sc = dynamic_cast<const style::StyleConsumer *>(c))
+            return sc->getStyleClass().cname;
+    }
+    return "component";
+}
+} // namespace sst::jucegui::components
+
+#define SST_JUCEGUI_PROFILE_SCOPE_FOR(component, what)                                            \
+    ::sst::jucegui::components::PaintProfiler::Scope sstJuceguiProfileScope(                      \
+        ::sst::jucegui::components::profileClassName(component), what)
+#else
+#define SST_JUCEGUI_PROFILE_SCOPE_FOR(component, what)
+#endif
+
+// Time the rest of the enclosing member function of a component
+#define SST_JUCEGUI_PROFILE_SCOPE(what) SST_JUCEGUI_PROFILE_SCOPE_FOR(this, what)
+
+#endif // SST_JUCEGUI_PAINTPROFILER_H
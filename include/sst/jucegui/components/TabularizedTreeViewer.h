@@ -26,8 +26,10 @@
 #include <sst/jucegui/components/BaseStyles.h>
 
 #include <string>
+#include <limits>
 
 #include "ComponentBase.h"
+#include "FrameScheduler.h"
 
 namespace sst::jucegui::components
 {
@@ -35,10 +37,11 @@ struct TabularizedTreeViewer : public juce::Component,
                                public style::StyleConsumer,
                                public style::SettingsConsumer,
                                public EditableComponentBase<TabularizedTreeViewer>,
-                               public data::TabularizedTreeView::Listener
+                               public data::TabularizedTreeView::Listener,
+                               public FrameScheduler::Client
 {
     TabularizedTreeViewer();
-    ~TabularizedTreeViewer() = default;
+    ~TabularizedTreeViewer();
 
     struct Styles : ControlStyles
     {
@@ -51,6 +54,7 @@ struct TabularizedTreeViewer : public juce::Component,
         static constexpr sprop toggleglyphhovercol{"toggleglyphhover.color"};
 
         static constexpr sprop connectorcol{"connector.color"};
+        static constexpr sprop selectedrowcol{"selectedrow.color"};
 
         static void initialize()
         {
@@ -59,41 +63,118 @@ struct TabularizedTreeViewer : public juce::Component,
                 .withProperty(toggleboxcol)
                 .withProperty(toggleglyphcol)
                 .withProperty(toggleglyphhovercol)
-                .withProperty(connectorcol);
+                .withProperty(connectorcol)
+                .withProperty(selectedrowcol);
         }
     };
-    // TODO set up listeners
 
     void paint(juce::Graphics &g) override;
-    void setSource(data::TabularizedTreeView *d)
-    {
-        data = d;
-        recalcRowDisplayCache();
-        repaint();
-    }
+    void describeFootprint(util::Footprint &f) const override;
+    SST_JUCEGUI_DECLARE_FOOTPRINT(TabularizedTreeViewer, Styles::styleClass.cname);
+
+    // The viewer listens to the view for row changes, so the view must outlive it
+    void setSource(data::TabularizedTreeView *d);
+
+    void rowsInserted(uint32_t at, uint32_t count) override;
+    void rowsRemoved(uint32_t at, uint32_t count) override;
+    void rowChanged(uint32_t row) override;
 
     void mouseMove(const juce::MouseEvent &e) override;
+    void mouseDown(const juce::MouseEvent &e) override;
+    // Alt clicking a toggle expands or collapses the whole subtree
     void mouseUp(const juce::MouseEvent &e) override;
 
-  private:
-    struct RowDisplayData
-    {
-        juce::Rectangle<int> openCloseZone;
-        data::TabularizedTreeView::TabularizedRow::DisplayType type;
-        uint32_t row;
+    /*
+     * Up, down, page up, page down, home and end move the selection. Right opens the
+     * selected row or steps into it, left closes it or steps out to its parent, and with
+     * alt held both act on the whole subtree. Typing jumps to the next row whose label
+     * starts with what was typed, within typeAheadTimeoutMs of the last key.
+     */
+    bool keyPressed(const juce::KeyPress &key) override;
+    static constexpr uint32_t typeAheadTimeoutMs{1000};
+
+    // -1 for none. The viewer scrolls an enclosing Viewport to show the selection.
+    int getSelectedRow() const { return selectedRow; }
+    void setSelectedRow(int row);
+
+    /*
+     * Expand a subtree progressively, adding at most expandRowsPerFrame rows a frame
+     * so a huge folder opens without stalling the message thread.
+     */
+    void expandSubtree(uint32_t row, int maxDepth = std::numeric_limits<int>::max());
+    static constexpr uint32_t expandRowsPerFrame{2000};
+    bool onFrame(double nowMs) override;
+
+    // The height which shows every row
+    int getContentHeight() const { return data ? data->getRowCount() * rowHeight : 0; }
+
+    /*
+     * When the viewer is the viewed component of a juce::Viewport it sizes itself to the
+     * viewport's width and to getContentHeight (or the visible height, if larger) as rows
+     * come and go. Call this after resizing the viewport, which the viewer is not told of.
+     */
+    void sizeToViewport();
+    void parentHierarchyChanged() override { sizeToViewport(); }
+
+    data::TabularizedTreeView *getSource() const { return data; }
+
+    /*
+     * Columns after the first are laid out from the right at their widths, which start
+     * at the view's ColumnInfo::defaultWidth; the tree column takes what remains. A
+     * TabularizedTreeViewerHeader asks the viewer for the same bounds so they line up.
+     */
+    juce::Rectangle<int> getColumnBounds(uint32_t col, const juce::Rectangle<int> &area) const;
+    void setColumnWidth(uint32_t col, int w);
 
-        // If this becomes projibitive replace it with a bitmask
-        std::vector<bool> showLine;
-    };
-
-    void recalcRowDisplayCache();
-    std::vector<RowDisplayData> rowDisplayCache;
+  private:
+    /*
+     * Everything the viewer draws for a row follows from its index and the row itself,
+     * so there is no per row cache to rebuild; row deltas from the view only move the
+     * hover and repaint from the changed row down.
+     */
+    juce::Rectangle<int> openCloseZoneFor(uint32_t i) const;
+    // rows are a fixed height, so the row under a point is a division; -1 if none
+    int rowAt(const juce::Point<float> &p) const;
+    void repaintFromRow(uint32_t row);
+    void repaintRow(int row);
     int hoveredOpenCloseZone{-1};
+
+    int selectedRow{-1};
+    void scrollToRow(int row);
+    int rowsPerPage() const;
+    std::string typeAhead;
+    uint32_t lastTypeAheadMs{0};
     void rowClick(uint32_t row);
 
     static constexpr int rowHeight = 18, rowIndent = 20, hotzoneSize = 16;
 
+    // widths of columns 1..n; column 0 is the tree
+    std::vector<int> columnWidths;
+
     data::TabularizedTreeView *data{nullptr};
 };
+
+/*
+ * Column titles for a TabularizedTreeViewer. Clicking a title sorts the viewer's source
+ * by that column if it can sort, and clicking it again reverses the order.
+ */
+struct TabularizedTreeViewerHeader : public juce::Component, public style::StyleConsumer
+{
+    TabularizedTreeViewerHeader();
+    ~TabularizedTreeViewerHeader() = default;
+
+    void setViewer(TabularizedTreeViewer *v)
+    {
+        viewer = v;
+        repaint();
+    }
+
+    void paint(juce::Graphics &g) override;
+    SST_JUCEGUI_DECLARE_FOOTPRINT(TabularizedTreeViewerHeader, "tabularizedtreeviewerheader");
+    void mouseUp(const juce::MouseEvent &e) override;
+
+  private:
+    TabularizedTreeViewer *viewer{nullptr};
+};
 } // namespace sst::jucegui::components
 #endif // SST_JUCEGUI_TABULARIZEDTREEVIEWER_H
@@ -66,11 +66,13 @@ struct ToggleButton : public juce::Component,
 
     void mouseEnter(const juce::MouseEvent &e) override
     {
+        SST_JUCEGUI_PROFILE_SCOPE("mouseEnter");
         startHover();
         repaint();
     }
     void mouseExit(const juce::MouseEvent &e) override
     {
+        SST_JUCEGUI_PROFILE_SCOPE("mouseExit");
         endHover();
         repaint();
     }
@@ -79,6 +81,8 @@ struct ToggleButton : public juce::Component,
     void mouseUp(const juce::MouseEvent &e) override;
 
     void paint(juce::Graphics &g) override;
+    void describeFootprint(util::Footprint &f) const override;
+    SST_JUCEGUI_DECLARE_FOOTPRINT(ToggleButton, Styles::styleClass.cname);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ToggleButton);
 
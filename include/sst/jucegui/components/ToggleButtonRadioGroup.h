@@ -33,6 +33,8 @@
 
 namespace sst::jucegui::components
 {
+struct subordinateDiscrete;
+
 struct ToggleButtonRadioGroup : public juce::Component,
                                 public style::StyleConsumer,
                                 public style::SettingsConsumer,
@@ -59,6 +61,8 @@ struct ToggleButtonRadioGroup : public juce::Component,
     {
         if (data)
             data->removeGUIDataListener(this);
+        // the buttons' sub data points at the old source, so always rebuild
+        clearButtons();
         data = d;
         if (data)
             data->addGUIDataListener(this);
@@ -67,10 +71,22 @@ struct ToggleButtonRadioGroup : public juce::Component,
     }
 
     void resized() override;
+    void describeFootprint(util::Footprint &f) const override;
+    SST_JUCEGUI_DECLARE_FOOTPRINT(ToggleButtonRadioGroup, Styles::styleClass.cname);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ToggleButtonRadioGroup);
 
   private:
+    void clearButtons();
+
+    // A button was pressed. Edits and the journal see the group's source, not the button's.
+    friend struct subordinateDiscrete;
+    void selectFromButton(int idx);
+
+    // The size and button count last laid out; resized is a no-op until one changes
+    juce::Rectangle<int> laidOutBounds;
+    size_t laidOutButtons{0};
+
     std::string label;
     data::Discrete *data{nullptr};
 
@@ -44,6 +44,8 @@ struct VSlider : public ContinuousParamEditor, public style::StyleConsumer
     ~VSlider();
 
     void paint(juce::Graphics &g) override;
+    void describeFootprint(util::Footprint &f) const override;
+    SST_JUCEGUI_DECLARE_FOOTPRINT(VSlider, Styles::styleClass.cname);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VSlider);
 };
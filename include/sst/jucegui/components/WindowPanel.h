@@ -23,6 +23,9 @@
 #include <sst/jucegui/style/StyleAndSettingsConsumer.h>
 #include <sst/jucegui/style/StyleSheet.h>
 
+#include "FrameStats.h"
+#include "PaintProfiler.h"
+
 namespace sst::jucegui::components
 {
 struct WindowPanel : public juce::Component,
@@ -50,12 +53,26 @@ struct WindowPanel : public juce::Component,
 
     void paint(juce::Graphics &g) override
     {
+        if (auto fs = FrameStats::getActive(); fs && isOutermostPanel())
+            fs->beginFrame();
+        SST_JUCEGUI_PROFILE_SCOPE("paint");
         auto cg = juce::ColourGradient::vertical(getColour(Styles::backgroundgradstart), 0,
                                                  getColour(Styles::backgroundgradend), getHeight());
         g.setGradientFill(cg);
         g.fillRect(getLocalBounds());
     }
 
+    // JUCE paints this after every child, so the frame covers the whole window
+    void paintOverChildren(juce::Graphics &) override
+    {
+        if (auto fs = FrameStats::getActive(); fs && isOutermostPanel())
+            fs->endFrame();
+    }
+
+    SST_JUCEGUI_DECLARE_FOOTPRINT(WindowPanel, Styles::styleClass.cname);
+
+    bool isOutermostPanel() const { return findParentComponentOfClass<WindowPanel>() == nullptr; }
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WindowPanel);
 };
 } // namespace sst::jucegui::components
@@ -20,9 +20,11 @@
 
 #include <utility>
 #include <string>
-#include <unordered_set>
 
+#include <sst/jucegui/util/SmallListenerList.h>
 #include "Labeled.h"
+#include "ContinuousMapping.h"
+#include "LiveModulationFeed.h"
 
 namespace sst::jucegui::data
 {
@@ -36,16 +38,35 @@ struct Continuous : public Labeled
         // FIXME - in the future we may want this more fine grained
         virtual void dataChanged() = 0;
     };
-    void addGUIDataListener(DataListener *l) { guilisteners.insert(l); }
-    void removeGUIDataListener(DataListener *l) { guilisteners.erase(l); }
-    void addModelDataListener(DataListener *l) { modellisteners.insert(l); }
-    void removeModelDataListener(DataListener *l) { modellisteners.erase(l); }
+    void addGUIDataListener(DataListener *l) { guilisteners.add(l); }
+    void removeGUIDataListener(DataListener *l) { guilisteners.remove(l); }
+    void addModelDataListener(DataListener *l) { modellisteners.add(l); }
+    void removeModelDataListener(DataListener *l) { modellisteners.remove(l); }
 
     virtual float getValue() const = 0;
     virtual void setValueFromGUI(const float &f) = 0;
     virtual void setValueFromModel(const float &f) = 0;
     virtual float getDefaultValue() const = 0;
-    virtual float getValue01() { return (getValue() - getMin()) / (getMax() - getMin()); }
+    virtual float getValue01() { return valueTo01(getValue()); }
+
+    /*
+     * The mapping between values and the 0..1 position editors paint and drag in.
+     * The default, nullptr, is linear between getMin() and getMax(). Return one of the
+     * tabulated mappings in ContinuousMapping.h for log, exp, power or custom tapers.
+     */
+    virtual const ContinuousMapping *getMapping() const { return nullptr; }
+    float valueTo01(float v) const
+    {
+        if (auto m = getMapping())
+            return m->valueTo01(v);
+        return (v - getMin()) / (getMax() - getMin());
+    }
+    float value01ToValue(float f) const
+    {
+        if (auto m = getMapping())
+            return m->value01ToValue(f);
+        return getMin() + f * (getMax() - getMin());
+    }
 
     virtual std::string getValueAsStringFor(float f) const { return std::to_string(f); }
     virtual std::string getValueAsString() const { return getValueAsStringFor(getValue()); }
@@ -61,13 +82,21 @@ struct Continuous : public Labeled
 
     virtual bool isBipolar() const { return getMin() < 0 && getMax() > 0; }
 
+    /*
+     * Sources which are updated from the model at a low rate (automation at control
+     * rate, say) can ask editors to glide between model updates rather than jump.
+     * Return the longest glide in seconds; editors shorten it to the observed interval
+     * between updates. Zero, the default, draws every update as it arrives.
+     */
+    virtual float getDisplaySmoothingTime() const { return 0.f; }
+
     virtual void jog(int dir)
     {
         setValueFromGUI(std::clamp(getValue() + dir * getQuantizedStepSize(), getMin(), getMax()));
     }
 
   protected:
-    std::unordered_set<DataListener *> guilisteners, modellisteners;
+    util::SmallListenerList<DataListener> guilisteners, modellisteners;
 };
 
 struct ContinunousModulatable : public Continuous
@@ -76,6 +105,13 @@ struct ContinunousModulatable : public Continuous
     virtual void setModulationValuePM1(const float &f) = 0;
     virtual bool isModulationBipolar() const = 0;
     virtual float getQuantizedModulationStepSize() const { return 0.1; }
+
+    /*
+     * Attach a live feed of the modulated value from the audio thread by returning it
+     * here; editors then draw the current modulated position and a short trail. The
+     * feed must outlive any editor showing this source.
+     */
+    virtual const LiveModulationFeed *getLiveModulationFeed() const { return nullptr; }
 };
 
 } // namespace sst::jucegui::data
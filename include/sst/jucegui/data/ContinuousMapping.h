@@ -0,0 +1,182 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_DATA_CONTINUOUSMAPPING_H
+#define INCLUDE_SST_JUCEGUI_DATA_CONTINUOUSMAPPING_H
+
+#include <array>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <cmath>
+#include <cassert>
+
+namespace sst::jucegui::data
+{
+/**
+ * A ContinuousMapping converts between a parameter value and the 0..1 position
+ * which editors draw and drag in. A Continuous with no mapping is linear in
+ * [getMin(), getMax()]; frequency, gain and similar parameters return one of the
+ * mappings here from `Continuous::getMapping`.
+ *
+ * Mappings are immutable once built and can be shared between sources with the
+ * same range.
+ */
+struct ContinuousMapping
+{
+    virtual ~ContinuousMapping() = default;
+
+    virtual float valueTo01(float v) const = 0;
+    virtual float value01ToValue(float f) const = 0;
+};
+
+struct LinearMapping : ContinuousMapping
+{
+    float min, max;
+    LinearMapping(float mn, float mx) : min(mn), max(mx) {}
+
+    float valueTo01(float v) const override
+    {
+        return std::clamp((v - min) / (max - min), 0.f, 1.f);
+    }
+    float value01ToValue(float f) const override
+    {
+        return min + std::clamp(f, 0.f, 1.f) * (max - min);
+    }
+};
+
+/**
+ * TabulatedMapping samples a monotonic normalized-to-value curve at N + 1 evenly
+ * spaced points when it is built, so no pow or log is evaluated while painting or
+ * dragging. The forward direction is a table read and a lerp. The inverse is a
+ * binary search of the same table and a lerp, which makes it the exact inverse of
+ * the forward interpolation, so positions round trip through a value without drift.
+ *
+ * @tparam N the number of table segments
+ */
+template <int N = 256> struct TabulatedMapping : ContinuousMapping
+{
+    static_assert(N >= 1);
+
+    template <typename F> explicit TabulatedMapping(F &&normalizedToValue)
+    {
+        for (int i = 0; i <= N; ++i)
+            table[i] = normalizedToValue(1.f * i / N);
+        increasing = table[N] >= table[0];
+    }
+
+    float value01ToValue(float f) const override
+    {
+        auto x = std::clamp(f, 0.f, 1.f) * N;
+        auto i = std::min((int)x, N - 1);
+        auto frac = x - i;
+        return table[i] + frac * (table[i + 1] - table[i]);
+    }
+
+    float valueTo01(float v) const override
+    {
+        // index of the first table entry strictly past v in table order
+        auto it = increasing ? std::upper_bound(table.begin(), table.end(), v)
+                             : std::upper_bound(table.begin(), table.end(), v, std::greater<>());
+        auto hi = (int)(it - table.begin());
+        if (hi == 0)
+            return 0.f;
+        if (hi > N)
+            return 1.f;
+        auto lo = hi - 1;
+        auto span = table[hi] - table[lo];
+        auto frac = span == 0 ? 0.f : (v - table[lo]) / span;
+        return (lo + frac) / N;
+    }
+
+  protected:
+    std::array<float, N + 1> table{};
+    bool increasing{true};
+};
+
+/**
+ * Equal ratios per unit of travel; the usual frequency taper. Requires 0 < min < max.
+ */
+struct LogMapping : TabulatedMapping<>
+{
+    LogMapping(float min, float max)
+        : TabulatedMapping<>([min, max](float f) { return min * std::pow(max / min, f); })
+    {
+        assert(min > 0 && max > min);
+    }
+};
+
+/**
+ * An exponential curve through (0, min) and (1, max). Positive curvature spends more
+ * travel at the low end, negative at the high end, and zero is linear.
+ */
+struct ExpMapping : TabulatedMapping<>
+{
+    ExpMapping(float min, float max, float curvature)
+        : TabulatedMapping<>([min, max, curvature](float f) {
+              if (std::fabs(curvature) < 1e-5)
+                  return min + f * (max - min);
+              return min + (max - min) * std::expm1(curvature * f) / std::expm1(curvature);
+          })
+    {
+    }
+};
+
+/**
+ * value = min + (max - min) * f ^ exponent. An exponent of 2 or 3 is a common gain taper.
+ */
+struct PowerMapping : TabulatedMapping<>
+{
+    PowerMapping(float min, float max, float exponent)
+        : TabulatedMapping<>(
+              [min, max, exponent](float f) { return min + (max - min) * std::pow(f, exponent); })
+    {
+        assert(exponent > 0);
+    }
+};
+
+/**
+ * A custom taper given as (position, value) breakpoints with positions increasing from
+ * 0 to 1 and values monotonic. Values between breakpoints are linear.
+ */
+struct PiecewiseMapping : TabulatedMapping<>
+{
+    explicit PiecewiseMapping(const std::vector<std::pair<float, float>> &points)
+        : TabulatedMapping<>([&points](float f) { return evaluate(points, f); })
+    {
+    }
+
+  private:
+    static float evaluate(const std::vector<std::pair<float, float>> &points, float f)
+    {
+        assert(points.size() >= 2);
+        if (f <= points.front().first)
+            return points.front().second;
+        for (size_t i = 1; i < points.size(); ++i)
+        {
+            const auto &[x0, y0] = points[i - 1];
+            const auto &[x1, y1] = points[i];
+            if (f <= x1)
+                return x1 == x0 ? y1 : y0 + (f - x0) / (x1 - x0) * (y1 - y0);
+        }
+        return points.back().second;
+    }
+};
+} // namespace sst::jucegui::data
+
+#endif // SST_JUCEGUI_CONTINUOUSMAPPING_H
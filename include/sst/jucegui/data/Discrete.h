@@ -19,6 +19,8 @@
 #define INCLUDE_SST_JUCEGUI_DATA_DISCRETE_H
 
 #include <string>
+
+#include <sst/jucegui/util/SmallListenerList.h>
 #include "Labeled.h"
 
 namespace sst::jucegui::data
@@ -33,10 +35,10 @@ struct Discrete : public Labeled
         // FIXME - in the future we may want this more fine grained
         virtual void dataChanged() = 0;
     };
-    void addGUIDataListener(DataListener *l) { guilisteners.insert(l); }
-    void removeGUIDataListener(DataListener *l) { guilisteners.erase(l); }
-    void addModelDataListener(DataListener *l) { modellisteners.insert(l); }
-    void removeModelDataListener(DataListener *l) { modellisteners.erase(l); }
+    void addGUIDataListener(DataListener *l) { guilisteners.add(l); }
+    void removeGUIDataListener(DataListener *l) { guilisteners.remove(l); }
+    void addModelDataListener(DataListener *l) { modellisteners.add(l); }
+    void removeModelDataListener(DataListener *l) { modellisteners.remove(l); }
 
     virtual int getValue() const = 0;
     virtual void setValueFromGUI(const int &f) = 0;
@@ -60,7 +62,7 @@ struct Discrete : public Labeled
     }
 
   protected:
-    std::unordered_set<DataListener *> guilisteners, modellisteners;
+    util::SmallListenerList<DataListener> guilisteners, modellisteners;
 };
 
 struct BinaryDiscrete : public Discrete
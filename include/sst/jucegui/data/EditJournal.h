@@ -0,0 +1,107 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_DATA_EDITJOURNAL_H
+#define INCLUDE_SST_JUCEGUI_DATA_EDITJOURNAL_H
+
+#include <cstdint>
+#include <memory>
+
+#include <sst/jucegui/util/InlineCallback.h>
+#include "Continuous.h"
+
+namespace sst::jucegui::data
+{
+struct Discrete;
+
+/**
+ * EditJournal is an undo / redo history of GUI edits to Continuous and Discrete sources.
+ *
+ * Editors bracket each gesture with beginGesture / endGesture (they do this from the
+ * same place they call onBeginEdit / onEndEdit) and record each value they set. Every
+ * delta of one source within a gesture is merged into a single (source, old, new)
+ * entry, so a long drag costs one entry, and a gesture touching several sources is
+ * undone and redone as a unit.
+ *
+ * Entries live in a ring allocated once at construction; recording never allocates
+ * and when the ring is full the oldest gesture is dropped. Undo and redo apply values
+ * with setValueFromGUI, so the model sees them as ordinary edits, and bracket each one
+ * with onBeginEdit / onEndEdit so a host can report it as a gesture on that parameter.
+ *
+ * The journal identifies a parameter by its source pointer. If a source is destroyed
+ * while the journal holds entries for it, call forgetSource first.
+ */
+struct EditJournal
+{
+    explicit EditJournal(uint32_t capacity = 1 << 16);
+    ~EditJournal();
+
+    void beginGesture();
+    void endGesture();
+    void recordEdit(Continuous *source, float oldValue, float newValue);
+    void recordEdit(Discrete *source, int oldValue, int newValue);
+
+    // Called around each value undo or redo sets, with the Continuous or Discrete source
+    util::InlineCallback<void(Labeled *source)> onBeginEdit;
+    util::InlineCallback<void(Labeled *source)> onEndEdit;
+
+    bool canUndo() const { return applied > 0; }
+    bool canRedo() const { return applied < count; }
+    bool undo();
+    bool redo();
+
+    void clear();
+    void forgetSource(Labeled *source);
+
+    uint32_t getCapacity() const { return capacity; }
+    uint32_t getEntryCount() const { return count; }
+
+  private:
+    union Value
+    {
+        float f;
+        int i;
+    };
+    struct Entry
+    {
+        Labeled *source; // a Discrete if isDiscrete, else a Continuous
+        Value oldValue, newValue;
+        uint32_t gesture;
+        bool isDiscrete;
+
+        bool isNoOp() const
+        {
+            return isDiscrete ? oldValue.i == newValue.i : oldValue.f == newValue.f;
+        }
+    };
+
+    Entry &at(uint32_t i) { return entries[(head + i) % capacity]; }
+    void dropOldestGesture();
+    void record(Labeled *source, bool isDiscrete, Value oldValue, Value newValue);
+    void apply(Entry &e, bool toNew);
+
+    std::unique_ptr<Entry[]> entries;
+    uint32_t capacity{0};
+    uint32_t head{0}, count{0}, applied{0};
+
+    uint32_t currentGesture{0};
+    int gestureDepth{0};
+    bool isApplying{false};
+};
+} // namespace sst::jucegui::data
+
+#endif // SST_JUCEGUI_EDITJOURNAL_H
@@ -0,0 +1,103 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_DATA_LIVEMODULATIONFEED_H
+#define INCLUDE_SST_JUCEGUI_DATA_LIVEMODULATIONFEED_H
+
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+
+namespace sst::jucegui::data
+{
+/**
+ * A LiveModulationFeed carries the current modulated value of a parameter from
+ * the audio thread to the GUI. It is a fixed size single producer ring of the
+ * most recent samples, so memory per parameter is constant and neither side ever
+ * locks or allocates.
+ *
+ * The audio thread calls `push` with the modulated value in the 0..1 space of the
+ * parameter (that is, after the parameter mapping) at whatever rate it likes; once
+ * per block is typical. Editors read the ring once per display frame, so pushes
+ * faster than the frame rate are decimated for free. A reader racing a writer can
+ * see a sample one push newer than the count it read, which is harmless for display.
+ *
+ * Editors stop reading a feed which has gone quiet. Before they do they call
+ * markReaderIdle, and the next push bumps the process wide wake sequence, so one check
+ * of that per frame tells the GUI whether any quiet feed needs looking at again.
+ */
+struct LiveModulationFeed
+{
+    static constexpr uint32_t ringSize{32};
+    static_assert((ringSize & (ringSize - 1)) == 0, "ringSize must be a power of two");
+
+    // Audio thread
+    void push(float value01)
+    {
+        auto w = writeCount.load(std::memory_order_relaxed);
+        samples[w & (ringSize - 1)].store(value01, std::memory_order_relaxed);
+        // sequentially consistent with markReaderIdle, so one side always sees the other
+        writeCount.store(w + 1);
+        if (readerIdle.load() && readerIdle.exchange(false))
+            wakeSequence.fetch_add(1, std::memory_order_release);
+    }
+
+    // GUI thread
+    uint32_t getWriteCount() const { return writeCount.load(std::memory_order_acquire); }
+    bool hasSamples() const { return getWriteCount() > 0; }
+    float getLatest() const
+    {
+        auto w = getWriteCount();
+        if (w == 0)
+            return 0.f;
+        return samples[(w - 1) & (ringSize - 1)].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Copy up to n of the most recent samples into `into`, oldest first, and return
+     * how many were copied.
+     */
+    uint32_t copyRecent(float *into, uint32_t n) const
+    {
+        auto w = getWriteCount();
+        n = std::min({n, w, ringSize});
+        for (uint32_t i = 0; i < n; ++i)
+            into[i] = samples[(w - n + i) & (ringSize - 1)].load(std::memory_order_relaxed);
+        return n;
+    }
+
+    /**
+     * Ask the next push to bump the wake sequence. Returns false, leaving the reader
+     * awake, if there has been a push since sawCount, as that push may have missed
+     * the flag.
+     */
+    bool markReaderIdle(uint32_t sawCount) const
+    {
+        readerIdle.store(true);
+        return writeCount.load() == sawCount;
+    }
+    static uint32_t getWakeSequence() { return wakeSequence.load(std::memory_order_acquire); }
+
+  private:
+    std::atomic<float> samples[ringSize]{};
+    std::atomic<uint32_t> writeCount{0};
+    mutable std::atomic<bool> readerIdle{false};
+    static inline std::atomic<uint32_t> wakeSequence{0};
+};
+} // namespace sst::jucegui::data
+
+#endif // SST_JUCEGUI_LIVEMODULATIONFEED_H
@@ -0,0 +1,183 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_DATA_TREESEARCHINDEX_H
+#define INCLUDE_SST_JUCEGUI_DATA_TREESEARCHINDEX_H
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "TreeTable.h"
+
+namespace sst::jucegui::data
+{
+/**
+ * TreeSearchIndex is a case insensitive substring index over the labels of a tree.
+ * Labels are broken into trigrams with a sorted posting list of entries per trigram, so
+ * a query intersects a few short lists and checks only the candidates it leaves.
+ *
+ * The index is built in slices: call indexSome with a budget from a timer or frame
+ * callback until it returns false. Entries are not thread safe, so this happens on the
+ * GUI thread rather than a worker. The index only walks children which are already
+ * loaded; children which arrive later through TreeTableData::notifyChildrenAdded are
+ * queued and picked up by the next slice.
+ *
+ * Entries are referred to by pointer and so must live as long as the index. When indexed
+ * children are replaced (TreeTableData::notifyChildrenReplaced) the index starts over,
+ * bumping the generation and the reset count; node ids from before a reset mean nothing.
+ * Views over the index hear of a replacement from it, once it has started over, rather
+ * than from the data.
+ */
+struct TreeSearchIndex : TreeTableData::DataListener
+{
+    explicit TreeSearchIndex(const TreeTableData &d);
+    ~TreeSearchIndex();
+
+    struct Node
+    {
+        TreeTableData::Entry *entry;
+        uint32_t parent;
+        uint32_t childIndex;
+        uint32_t childrenIndexed;
+        uint16_t depth;
+        bool queued;
+    };
+    static constexpr uint32_t noParent{~0u};
+
+    // Index up to budget more entries. Returns true while there is more to do.
+    bool indexSome(uint32_t budget);
+    bool isComplete() const { return pending.empty(); }
+
+    const TreeTableData &getData() const { return data; }
+    uint32_t getNodeCount() const { return nodes.size(); }
+    const Node &getNode(uint32_t id) const { return nodes[id]; }
+    int nodeFor(const TreeTableData::Entry *e) const;
+
+    // Bumped whenever indexSome adds entries, so callers can tell when to re-query
+    uint64_t getGeneration() const { return generation; }
+    // Bumped when the index starts over and hands out node ids afresh
+    uint64_t getResetCount() const { return resets; }
+
+    /**
+     * The ids, ascending, of entries whose label contains q ignoring case. An empty
+     * query matches everything. A query which extends the previous one, with nothing
+     * indexed in between, filters the previous result rather than searching again.
+     */
+    const std::vector<uint32_t> &query(const std::string &q);
+
+    struct IndexListener
+    {
+        virtual ~IndexListener() = default;
+        // The children of parent were replaced, and the index has started over if it had to
+        virtual void childrenReindexed(TreeTableData::Entry *parent) = 0;
+    };
+    void addIndexListener(IndexListener *l) { indexListeners.add(l); }
+    void removeIndexListener(IndexListener *l) { indexListeners.remove(l); }
+
+    void childrenAdded(TreeTableData::Entry *parent, uint32_t from, uint32_t count) override;
+    void childrenComplete(TreeTableData::Entry *parent) override {}
+    void childrenReplaced(TreeTableData::Entry *parent) override;
+
+  private:
+    void start();
+    void startOver();
+    uint32_t addNode(TreeTableData::Entry *e, uint32_t parent, uint32_t childIndex,
+                     uint16_t depth);
+    bool labelContains(uint32_t id, const std::string &lq) const;
+    static uint32_t trigramAt(const std::string &s, size_t i)
+    {
+        return ((uint32_t)(uint8_t)s[i] << 16) | ((uint32_t)(uint8_t)s[i + 1] << 8) |
+               (uint32_t)(uint8_t)s[i + 2];
+    }
+
+    const TreeTableData &data;
+    std::vector<Node> nodes;
+    std::unordered_map<const TreeTableData::Entry *, uint32_t> nodeByEntry;
+    std::deque<uint32_t> pending;
+
+    // Lower cased labels, back to back; label i is [labelStart[i], labelStart[i + 1])
+    std::string labels;
+    std::vector<uint32_t> labelStart{0};
+    std::unordered_map<uint32_t, std::vector<uint32_t>> postings;
+    uint64_t generation{0}, resets{0};
+
+    std::string lastQuery;
+    uint64_t lastGeneration{~0ull};
+    std::vector<uint32_t> lastResult, scratch;
+
+    util::SmallListenerList<IndexListener> indexListeners;
+};
+
+/**
+ * A TabularizedTreeView of the entries matching a query together with their ancestors,
+ * which start out open so every match is visible. Rows can be closed and reopened like
+ * the concrete view; reopening shows the matching children again.
+ *
+ * Call setQuery as the user types. Call refresh when the index has grown (compare
+ * TreeSearchIndex::getGeneration) to pick up new matches; rows are patched rather than
+ * rebuilt, and rows the user closed stay closed until the query changes. If the data is
+ * reloaded, or the index starts over, the view empties until the next refresh, as its
+ * rows may refer to entries or node ids which are gone.
+ */
+struct FilteredTabularizedViewOfTree : public TabularizedTreeView, TreeSearchIndex::IndexListener
+{
+    explicit FilteredTabularizedViewOfTree(TreeSearchIndex &idx);
+    ~FilteredTabularizedViewOfTree();
+
+    void setQuery(const std::string &q);
+    const std::string &getQuery() const { return query; }
+    void refresh();
+
+    uint32_t getRowCount() const override { return rows.size(); }
+    const TabularizedRow &getRow(uint32_t r) const override
+    {
+        assert(r < rows.size());
+        return rows[r];
+    }
+    void open(int displayRow) override;
+    void close(int displayRow) override;
+
+    uint32_t getColumnCount() const override { return index.getData().getColumnCount(); }
+    ColumnInfo getColumnInfo(uint32_t col) const override
+    {
+        return index.getData().getColumnInfo(col);
+    }
+
+    void childrenReindexed(TreeTableData::Entry *parent) override;
+
+  private:
+    TabularizedRow rowFor(uint32_t id) const;
+    // Flatten node id, and unless closed its included children, into out
+    void appendRows(std::vector<TabularizedRow> &out, uint32_t id) const;
+    // Empty the view if the index started over since it was built; true if it did
+    bool dropIfIndexReset();
+
+    TreeSearchIndex &index;
+    std::string query;
+    // The matching subtree: for each included node, its included children in order
+    std::unordered_map<uint32_t, std::vector<uint32_t>> includedChildren;
+    uint64_t builtForReset{0};
+    // Entries the user closed, by id, which refresh leaves closed
+    std::unordered_set<uint64_t> closedIds;
+    rows_t rows;
+};
+} // namespace sst::jucegui::data
+
+#endif // SST_JUCEGUI_TREESEARCHINDEX_H
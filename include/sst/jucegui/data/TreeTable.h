@@ -21,10 +21,57 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <cassert>
+#include <cstdint>
+
+#include <sst/jucegui/util/GapBuffer.h>
+#include <sst/jucegui/util/SmallListenerList.h>
 
 namespace sst::jucegui::data
 {
+// s with ASCII letters lower cased, which is how labels are matched ignoring case
+std::string lowerCased(std::string s);
+
+/*
+ * A typed cell in a tree table column. Values of a column compare by their type, so
+ * sizes and dates sort numerically while still displaying as text.
+ */
+struct ColumnValue
+{
+    enum Type : uint8_t
+    {
+        NONE,
+        STRING,
+        INTEGER,
+        FLOAT,
+        SIZE, // bytes
+        DATE  // milliseconds since the epoch
+    } type{NONE};
+    std::string s;
+    int64_t i{0};
+    double f{0};
+
+    static ColumnValue ofString(std::string v) { return {STRING, std::move(v)}; }
+    static ColumnValue ofInteger(int64_t v) { return {INTEGER, {}, v}; }
+    static ColumnValue ofFloat(double v) { return {FLOAT, {}, 0, v}; }
+    static ColumnValue ofSize(uint64_t bytes) { return {SIZE, {}, (int64_t)bytes}; }
+    static ColumnValue ofDate(int64_t msSinceEpoch) { return {DATE, {}, msSinceEpoch}; }
+
+    std::string toDisplayString() const;
+    // <0, 0, >0 like strcmp. Strings compare ignoring case; NONE sorts first.
+    static int compare(const ColumnValue &a, const ColumnValue &b);
+};
+
+struct ColumnInfo
+{
+    std::string name;
+    ColumnValue::Type type{ColumnValue::STRING};
+    int defaultWidth{100};
+};
+
 /*
  * A TreeTable has parent-child relationships between nodes
  */
@@ -34,52 +81,235 @@ struct TreeTableData
     struct Entry
     {
         virtual ~Entry() = default;
-        uint64_t id;
+
+        /*
+         * A stable identity for the entry, the same across a rescan which replaces the
+         * Entry objects, such as a hash of a file path. Views key expansion state by it
+         * so a reload keeps open folders open. Ids must be unique within a tree; an
+         * entry which leaves it 0 is identified by its address instead.
+         */
+        uint64_t id{0};
 
         virtual bool hasChildren() const = 0;
         virtual uint32_t getChildCount() const = 0;
 
         virtual const std::unique_ptr<Entry> &getChildAt(uint32_t idx) = 0;
         virtual std::string getLabel() const = 0;
-        // virtual T getDataForColumn(int i) const = 0;
+
+        // Column 0 is the tree column and shows the label
+        virtual ColumnValue getDataForColumn(uint32_t col) const
+        {
+            if (col == 0)
+                return ColumnValue::ofString(getLabel());
+            return {};
+        }
+
+        /*
+         * Entries whose children are slow to enumerate (a network share, a large
+         * database) can load them asynchronously. Such an entry reports LOADING until
+         * it has them all, and views call requestChildren when it is opened; it should
+         * start enumeration on a worker and return at once, and ignore repeat requests.
+         *
+         * As batches arrive the entry grows getChildCount and calls
+         * TreeTableData::notifyChildrenAdded, and when done notifyChildrenComplete.
+         * Both must happen on the GUI thread so getChildCount only changes there.
+         */
+        enum ChildState
+        {
+            READY,
+            LOADING
+        };
+        virtual ChildState getChildState() const { return READY; }
+        virtual void requestChildren() {}
     };
 
     virtual const std::unique_ptr<Entry> &getRoot() const = 0;
+
+    virtual uint32_t getColumnCount() const { return 1; }
+    virtual ColumnInfo getColumnInfo(uint32_t col) const
+    {
+        if (col == 0)
+            return {"Name", ColumnValue::STRING, 200};
+        return {};
+    }
+
+    struct DataListener
+    {
+        virtual ~DataListener() = default;
+        virtual void childrenAdded(Entry *parent, uint32_t from, uint32_t count) = 0;
+        virtual void childrenComplete(Entry *parent) = 0;
+        // The children of parent were rescanned. See notifyChildrenReplaced.
+        virtual void childrenReplaced(Entry *parent) {}
+    };
+    // Views observe the data they present, which they hold as const
+    void addDataListener(DataListener *l) const { dataListeners.add(l); }
+    void removeDataListener(DataListener *l) const { dataListeners.remove(l); }
+
+    void notifyChildrenAdded(Entry *parent, uint32_t from, uint32_t count)
+    {
+        for (auto *l : dataListeners)
+            l->childrenAdded(parent, from, count);
+    }
+    void notifyChildrenComplete(Entry *parent)
+    {
+        for (auto *l : dataListeners)
+            l->childrenComplete(parent);
+    }
+    /*
+     * After a rescan has changed the children of parent, and perhaps replaced them and
+     * their descendants with new Entry objects, or with parent null after replacing the
+     * root. Views patch in the difference by Entry::id. Entries which were dropped must
+     * stay alive until this returns.
+     */
+    void notifyChildrenReplaced(Entry *parent)
+    {
+        for (auto *l : dataListeners)
+            l->childrenReplaced(parent);
+    }
+
+  protected:
+    mutable util::SmallListenerList<DataListener> dataListeners;
 };
 
 struct TabularizedTreeView
 {
     virtual ~TabularizedTreeView() = default;
+    /*
+     * Views report structural changes as deltas so a viewer can patch what it shows
+     * rather than rebuilding it. Indices are display rows after the change.
+     */
     struct Listener
     {
+        virtual ~Listener() = default;
+        virtual void rowsInserted(uint32_t at, uint32_t count) {}
+        virtual void rowsRemoved(uint32_t at, uint32_t count) {}
+        virtual void rowChanged(uint32_t row) {}
     };
+    void addListener(Listener *l) { listeners.add(l); }
+    void removeListener(Listener *l) { listeners.remove(l); }
 
+    /*
+     * A row is a reference to its entry plus where it sits, 16 bytes with no heap
+     * storage, so a flattened view of a large tree costs little more than its row count.
+     * The label is read from the entry when asked for, and the path from the root is
+     * rebuilt on demand by TabularizedTreeView::getPath.
+     */
     struct TabularizedRow
     {
-        enum DisplayType
+        TreeTableData::Entry *entry{nullptr};
+        uint32_t childIndex{0};
+        uint16_t depth{0};
+        enum DisplayType : uint8_t
         {
             NODE,
             OPEN,
-            CLOSED
-        } type;
-        std::string label;
-        uint32_t depth;
+            CLOSED,
+            // stands in for the rest of the children of a loading entry, which it refers to
+            PLACEHOLDER
+        } type{NODE};
+
+        bool isExpandable() const { return type == OPEN || type == CLOSED; }
+        std::string getLabel() const
+        {
+            if (type == PLACEHOLDER)
+                return "Loading...";
+            return entry ? entry->getLabel() : std::string();
+        }
 
         typedef std::vector<uint32_t> path_t;
-        path_t path;
     };
 
     virtual uint32_t getRowCount() const = 0;
     virtual const TabularizedRow &getRow(uint32_t r) const = 0;
+
+    // The child indices leading from the root to row r
+    virtual TabularizedRow::path_t getPath(uint32_t r) const
+    {
+        auto res = TabularizedRow::path_t();
+        if (r >= getRowCount())
+            return res;
+        auto d = getRow(r).depth;
+        res.resize(d);
+        // each ancestor is the nearest preceding row one level up
+        for (int i = r; i >= 0 && d > 0; --i)
+        {
+            const auto &row = getRow(i);
+            if (row.depth == d)
+            {
+                res[d - 1] = row.childIndex;
+                d--;
+            }
+        }
+        return res;
+    }
     virtual void open(int displayRow) = 0;
     virtual void close(int displayRow) = 0;
+
+    /*
+     * The first row at or after from, wrapping round, whose label starts with prefix
+     * ignoring case; -1 if there is none. This drives type-ahead in a viewer. The default
+     * reads every label in turn.
+     */
+    virtual int findRowWithPrefix(const std::string &prefix, uint32_t from);
+
+    /*
+     * Open a row and its descendants down to maxDepth levels below it. Large subtrees
+     * appear progressively: the expansion only starts here, and each expandSome call
+     * adds up to rowBudget more rows, returning true while there is more to add. A
+     * viewer calls it once per frame. Views which cannot stream open the row.
+     */
+    virtual void expandSubtree(int displayRow, int maxDepth)
+    {
+        if (getRow(displayRow).type == TabularizedRow::CLOSED)
+            open(displayRow);
+    }
+    virtual bool expandSome(uint32_t rowBudget) { return false; }
+    virtual bool isExpanding() const { return false; }
+    // Close a row and everything under it, stopping any expansion there
+    virtual void collapseSubtree(int displayRow)
+    {
+        if (getRow(displayRow).type == TabularizedRow::OPEN)
+            close(displayRow);
+    }
+
+    virtual uint32_t getColumnCount() const { return 1; }
+    virtual ColumnInfo getColumnInfo(uint32_t col) const { return {"Name"}; }
+
+    // Views which can sort order siblings by a column; -1 is the natural order
+    virtual bool canSort() const { return false; }
+    virtual void setSortColumn(int col, bool ascending) {}
+    virtual int getSortColumn() const { return -1; }
+    virtual bool isSortAscending() const { return true; }
+
+  protected:
+    util::SmallListenerList<Listener> listeners;
+
+    typedef util::GapBuffer<TabularizedRow> rows_t;
+    static uint64_t idOf(const TreeTableData::Entry *e)
+    {
+        return e->id ? e->id : (uint64_t)(uintptr_t)e;
+    }
+    // Turn rows [from, to) into fresh, reporting the difference as deltas
+    void patchRows(rows_t &rows, uint32_t from, uint32_t to,
+                   const std::vector<TabularizedRow> &fresh);
+    // All row inserts and removes are reported through these
+    virtual void rowsWereInserted(uint32_t at, uint32_t count)
+    {
+        for (auto *l : listeners)
+            l->rowsInserted(at, count);
+    }
+    virtual void rowsWereRemoved(uint32_t at, uint32_t count)
+    {
+        for (auto *l : listeners)
+            l->rowsRemoved(at, count);
+    }
 };
 
-struct ConcreteTabularizedViewOfTree : public TabularizedTreeView
+struct ConcreteTabularizedViewOfTree : public TabularizedTreeView, TreeTableData::DataListener
 {
     const TreeTableData &data;
     ConcreteTabularizedViewOfTree(const TreeTableData &d);
-    virtual ~ConcreteTabularizedViewOfTree() = default;
+    virtual ~ConcreteTabularizedViewOfTree();
 
     uint32_t getRowCount() const override;
 
@@ -91,9 +321,118 @@ struct ConcreteTabularizedViewOfTree : public TabularizedTreeView
 
     void open(int displayRow) override;
     void close(int displayRow) override;
+    int findRowWithPrefix(const std::string &prefix, uint32_t from) override;
+
+    void childrenAdded(TreeTableData::Entry *parent, uint32_t from, uint32_t count) override;
+    void childrenComplete(TreeTableData::Entry *parent) override;
+    void childrenReplaced(TreeTableData::Entry *parent) override;
+
+    uint32_t getColumnCount() const override { return data.getColumnCount(); }
+    ColumnInfo getColumnInfo(uint32_t col) const override { return data.getColumnInfo(col); }
+
+    /*
+     * Sorting reorders the children of open rows only. The order of a parent's children
+     * by a column is computed when first needed and kept, so switching back to a column
+     * or reopening a node reuses it. Children of an entry still loading stay in arrival
+     * order until it completes.
+     */
+    bool canSort() const override { return true; }
+    void setSortColumn(int col, bool ascending) override;
+    int getSortColumn() const override { return sortColumn; }
+    bool isSortAscending() const override { return sortAscending; }
+
+    void expandSubtree(int displayRow, int maxDepth) override;
+    bool expandSome(uint32_t rowBudget) override;
+    bool isExpanding() const override { return !expansion.stack.empty(); }
+    void collapseSubtree(int displayRow) override;
 
   private:
-    typedef std::vector<TabularizedRow> rows_t;
+    /*
+     * A running expandSubtree. The stack is the walk's path through the tree; each
+     * level remembers its next child. Rows go in at nextRow, and row changes elsewhere
+     * in the view move rootRow and nextRow to match.
+     */
+    struct Expansion
+    {
+        struct Cursor
+        {
+            TreeTableData::Entry *entry;
+            uint32_t position;
+            uint16_t depth;
+        };
+        std::vector<Cursor> stack;
+        uint32_t rootRow{0}, nextRow{0};
+        int maxDepth{0};
+    } expansion;
+    bool isBeingExpanded(const TreeTableData::Entry *e) const;
+    // End it without leaving rows it is inside half filled; returns the rows added at nextRow
+    uint32_t stopExpansion();
+
+    // Keep a running expansion's rows in step with inserts and removes elsewhere
+    void rowsWereInserted(uint32_t at, uint32_t count) override;
+    void rowsWereRemoved(uint32_t at, uint32_t count) override;
+    bool isPlaceholderFor(uint32_t row, uint32_t parentRow) const;
+
+    // The child index shown at position k among the children of e
+    uint32_t childAtPosition(TreeTableData::Entry *e, uint32_t k);
+    TabularizedRow rowForChild(TreeTableData::Entry *e, uint32_t idx, uint16_t depth) const;
+    TabularizedRow rowForRoot() const;
+    void reflatten();
+
+    /*
+     * Which entries are open, by id. Every shown row is OPEN exactly when its id is here;
+     * ids of hidden entries are kept, so closing and reopening a row, or reloading the
+     * data, brings back what was open below it. collapseSubtree forgets them.
+     */
+    std::unordered_set<uint64_t> expandedIds;
+    // Flatten tr, and if open its children, into out as the view would show them
+    void appendRow(std::vector<TabularizedRow> &out, TabularizedRow tr);
+    void appendChildren(std::vector<TabularizedRow> &out, TreeTableData::Entry *e,
+                        uint16_t depth);
+    // Flatten the children of the open row r afresh and patch the difference into place
+    void patchChildren(uint32_t r);
+    /*
+     * The lower cased labels of an entry's children, sorted, and the child index at each
+     * place in that order. The children matching a prefix are then a range of places
+     * found by binary search.
+     */
+    struct PrefixIndex
+    {
+        std::vector<std::string> labels;
+        std::vector<uint32_t> child;
+    };
+    std::unordered_map<const TreeTableData::Entry *, PrefixIndex> prefixIndex;
+    const PrefixIndex &prefixIndexFor(TreeTableData::Entry *e);
+
+    /*
+     * The row showing each entry and the open rows, so type-ahead can go from a matching
+     * child to its row without walking the view. Built when first needed after the rows
+     * change, so a run of keystrokes over a still view pays for it once.
+     */
+    struct RowMap
+    {
+        bool valid{false};
+        std::unordered_map<const TreeTableData::Entry *, uint32_t> rowOf;
+        std::vector<uint32_t> openRows;
+    } rowMap;
+    const RowMap &rowMapFor();
+
+    int sortColumn{-1};
+    bool sortAscending{true};
+    std::map<std::pair<const TreeTableData::Entry *, int>, std::vector<uint32_t>> sortCache;
+
+    // One past the last row of the open subtree at r
+    uint32_t subtreeEnd(uint32_t r) const;
+    /*
+     * The open row showing e, or -1. Entries not in expandedIds are answered at once,
+     * and the row last found for an entry is tried first. Otherwise the row map is
+     * asked, so the batches of a loading folder, shown or hidden under a closed
+     * ancestor, do not each scan the view.
+     */
+    int openRowFor(const TreeTableData::Entry *e);
+    std::unordered_map<const TreeTableData::Entry *, uint32_t> openRowHint;
+
+    // A gap buffer so open and close cost the rows they insert or remove
     rows_t rows;
 };
 
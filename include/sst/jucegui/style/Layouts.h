@@ -24,6 +24,13 @@
 #define INCLUDE_SST_JUCEGUI_STYLE_LAYOUTS_H
 
 #include <juce_gui_basics/juce_gui_basics.h>
+#include <array>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <type_traits>
 #include <vector>
 
 namespace sst::jucegui::style
@@ -40,6 +47,10 @@ namespace sst::jucegui::style
  * }
  * ```
  *
+ * Integral rectangles get the pixels an even split leaves over, one each to the first
+ * sections, so the sections always cover the rectangle. For layouts with fixed, weighted
+ * or bounded sections, or to avoid the vector, use TrackLayout below.
+ *
  * @tparam T the storage type in the juce::Rectangle
  */
 template <typename T> struct EvenDivision
@@ -61,25 +72,22 @@ template <typename T> struct EvenDivision
     EvenDivision(const juce::Rectangle<T> &divide, int into, const Orientation &thisway)
     {
         jassert(into > 0);
-        if (thisway == HORIZONTAL)
-        {
-            auto w = divide.getWidth() / into;
-            auto q = divide.withWidth(w);
-            for (int i = 0; i < into; ++i)
-            {
-                store.push_back(q);
-                q = q.translated(w, 0);
-            }
-        }
-        else
+        store.reserve(into);
+        auto length = thisway == HORIZONTAL ? divide.getWidth() : divide.getHeight();
+        auto each = length / into;
+        T extra{0};
+        if constexpr (std::is_integral_v<T>)
+            extra = length - each * into;
+
+        T pos{0};
+        for (int i = 0; i < into; ++i)
         {
-            auto h = divide.getHeight() / into;
-            auto q = divide.withHeight(h);
-            for (int i = 0; i < into; ++i)
-            {
-                store.push_back(q);
-                q = q.translated(0, h);
-            }
+            auto sz = each + (i < extra ? 1 : 0);
+            if (thisway == HORIZONTAL)
+                store.push_back(divide.withX(divide.getX() + pos).withWidth(sz));
+            else
+                store.push_back(divide.withY(divide.getY() + pos).withHeight(sz));
+            pos += sz;
         }
     }
 
@@ -93,6 +101,378 @@ template <typename T> struct EvenDivision
     iterator end() { return store.end(); }
     const_iterator end() const { return store.end(); }
 };
+
+/**
+ * One track (a column or row) of a TrackLayout: a fixed number of pixels, or a weighted
+ * share of what the fixed tracks and gaps leave, and in either case clamped to
+ * [minPx, maxPx].
+ */
+struct Track
+{
+    enum Kind : uint8_t
+    {
+        FIXED,
+        WEIGHTED
+    };
+    Kind kind{WEIGHTED};
+    double amount{1}; // pixels for FIXED, the weight for WEIGHTED
+    int minPx{0}, maxPx{INT_MAX};
+
+    static constexpr Track fixed(int px) { return {FIXED, (double)px, 0, INT_MAX}; }
+    static constexpr Track weight(double w = 1) { return {WEIGHTED, w, 0, INT_MAX}; }
+    constexpr Track withMin(int px) const { return {kind, amount, px, maxPx}; }
+    constexpr Track withMax(int px) const { return {kind, amount, minPx, px}; }
+};
+
+/**
+ * Splits a length, or a juce::Rectangle along one axis, into up to maxTracks tracks with
+ * gaps between them, in the spirit of a one line juce::FlexBox without its allocations.
+ * Everything lives in fixed size arrays, so a layout can be built in resized() at no
+ * heap cost, or solved entirely at compile time:
+ *
+ * ```
+ * static constexpr auto cols = TrackLayout<3>()
+ *                                  .add(Track::fixed(20))
+ *                                  .add(Track::weight(2).withMin(40))
+ *                                  .add(Track::weight(1))
+ *                                  .withGap(4)
+ *                                  .solve(300);
+ * ```
+ *
+ * Weighted tracks share the space as flex items do: a track whose share falls outside
+ * its bounds is clamped and the others share the rest. Sizes are whole pixels which sum
+ * to exactly the space given, with the pixels left over by rounding down going to the
+ * tracks which lost the largest fractions. If nothing is weighted the space past the
+ * last fixed track is left empty; if the tracks do not fit they overflow the end.
+ */
+template <size_t maxTracks> struct TrackLayout
+{
+    enum Orientation
+    {
+        HORIZONTAL,
+        VERTICAL
+    };
+
+    std::array<Track, maxTracks> tracks{};
+    size_t count{0};
+    int gap{0};
+
+    // Tracks past maxTracks are dropped
+    constexpr TrackLayout &add(const Track &t)
+    {
+        if (count < maxTracks)
+            tracks[count++] = t;
+        return *this;
+    }
+    constexpr TrackLayout &add(const Track &t, size_t times)
+    {
+        for (size_t i = 0; i < times; ++i)
+            add(t);
+        return *this;
+    }
+    constexpr TrackLayout &withGap(int g)
+    {
+        gap = g;
+        return *this;
+    }
+
+    struct Solution
+    {
+        std::array<int, maxTracks> offset{}, size{};
+        size_t count{0};
+    };
+
+    constexpr Solution solve(int length) const
+    {
+        Solution res;
+        res.count = count;
+        if (count == 0)
+            return res;
+
+        auto clampPx = [](const Track &t, double v) {
+            return v < t.minPx ? (double)t.minPx : v > t.maxPx ? (double)t.maxPx : v;
+        };
+
+        // Fixed tracks first, then the weighted ones share what is left
+        std::array<bool, maxTracks> frozen{};
+        std::array<double, maxTracks> share{};
+        double free = length - (double)gap * (double)(count - 1);
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (tracks[i].kind == Track::FIXED)
+            {
+                share[i] = clampPx(tracks[i], tracks[i].amount);
+                frozen[i] = true;
+                free -= share[i];
+            }
+        }
+
+        for (size_t pass = 0; pass <= count; ++pass)
+        {
+            double weights{0}, left{free};
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (frozen[i])
+                    left -= tracks[i].kind == Track::WEIGHTED ? share[i] : 0;
+                else
+                    weights += tracks[i].amount;
+            }
+            if (weights <= 0)
+                break;
+
+            // Clamp, then freeze the side which was violated most, as flexbox does
+            double violation{0};
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (frozen[i])
+                    continue;
+                auto raw = left * tracks[i].amount / weights;
+                share[i] = clampPx(tracks[i], raw);
+                violation += share[i] - raw;
+            }
+            auto anyFrozen = false;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (frozen[i])
+                    continue;
+                auto raw = left * tracks[i].amount / weights;
+                if ((violation > 0 && share[i] > raw) || (violation < 0 && share[i] < raw))
+                {
+                    frozen[i] = true;
+                    anyFrozen = true;
+                }
+            }
+            if (!anyFrozen)
+                break;
+        }
+
+        // Whole pixels: round down, then hand the leftover pixels to the largest fractions
+        int used{0};
+        for (size_t i = 0; i < count; ++i)
+        {
+            res.size[i] = share[i] > 0 ? (int)share[i] : 0;
+            used += res.size[i];
+        }
+        auto anyWeighted = false;
+        for (size_t i = 0; i < count; ++i)
+            anyWeighted = anyWeighted || tracks[i].kind == Track::WEIGHTED;
+        int weightedLeft = anyWeighted ? length - gap * (int)(count - 1) - used : 0;
+
+        std::array<bool, maxTracks> bumped{};
+        for (; weightedLeft > 0; --weightedLeft)
+        {
+            int best{-1};
+            double bestFrac{-1};
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto frac = share[i] - res.size[i];
+                auto canGrow = tracks[i].kind == Track::WEIGHTED && res.size[i] < tracks[i].maxPx;
+                if (!bumped[i] && canGrow && frac > bestFrac)
+                {
+                    best = (int)i;
+                    bestFrac = frac;
+                }
+            }
+            if (best < 0)
+                break;
+            bumped[best] = true;
+            res.size[best]++;
+        }
+
+        int pos{0};
+        for (size_t i = 0; i < count; ++i)
+        {
+            res.offset[i] = pos;
+            pos += res.size[i] + gap;
+        }
+        return res;
+    }
+
+    template <typename T> struct Rectangles
+    {
+        std::array<juce::Rectangle<T>, maxTracks> rects{};
+        size_t count{0};
+
+        const juce::Rectangle<T> &operator[](size_t i) const { return rects[i]; }
+        size_t size() const { return count; }
+        auto begin() const { return rects.begin(); }
+        auto end() const { return rects.begin() + count; }
+    };
+
+    // Solve for the width (or height) of r and cut r into the tracks
+    template <typename T>
+    Rectangles<T> layout(const juce::Rectangle<T> &r, Orientation o = HORIZONTAL) const
+    {
+        auto length = o == HORIZONTAL ? r.getWidth() : r.getHeight();
+        auto s = solve((int)std::lround((double)length));
+        Rectangles<T> res;
+        res.count = s.count;
+        for (size_t i = 0; i < s.count; ++i)
+        {
+            if (o == HORIZONTAL)
+                res.rects[i] = r.withX(r.getX() + (T)s.offset[i]).withWidth((T)s.size[i]);
+            else
+                res.rects[i] = r.withY(r.getY() + (T)s.offset[i]).withHeight((T)s.size[i]);
+        }
+        return res;
+    }
+};
+
+/**
+ * A declarative layout which remembers what it solved. Describe the editor once as
+ * nested nodes of tracks, each track placing a component or another node, and call
+ * apply(bounds) from resized():
+ *
+ * ```
+ * auto &root = tree.node(Tracks::VERTICAL);
+ * auto &header = tree.node(Tracks::HORIZONTAL).add(Track::weight(), &title);
+ * root.add(Track::fixed(24), header).add(Track::weight(), &body);
+ * ...
+ * void resized() override { tree.apply(getLocalBounds()); }
+ * ```
+ *
+ * A node solves its tracks again only when its size or its content changed; if it only
+ * moved the old solution is translated. A node whose bounds are unchanged and under
+ * which nothing was invalidated is skipped with its whole subtree, and one with an
+ * invalidated node below is only walked to reach it, so a live resize only does work
+ * where the constraints did change. When what a node lays out changes
+ * (a track edited, a label which sizes a track rewritten) call invalidate(), or
+ * setContentVersion with a counter the content keeps.
+ */
+struct LayoutTree
+{
+    static constexpr size_t maxTracks{16};
+    using Tracks = TrackLayout<maxTracks>;
+
+    struct Node
+    {
+        Tracks tracks;
+        Tracks::Orientation orientation{Tracks::HORIZONTAL};
+
+        Node &add(const Track &t, juce::Component *c = nullptr)
+        {
+            jassert(tracks.count < maxTracks);
+            if (tracks.count == maxTracks)
+                return *this;
+            components[tracks.count] = c;
+            tracks.add(t);
+            invalidate();
+            return *this;
+        }
+        Node &add(const Track &t, Node &child)
+        {
+            jassert(tracks.count < maxTracks);
+            if (tracks.count == maxTracks)
+                return *this;
+            children[tracks.count] = &child;
+            child.parent = this;
+            tracks.add(t);
+            invalidate();
+            return *this;
+        }
+        Node &withGap(int g)
+        {
+            tracks.withGap(g);
+            invalidate();
+            return *this;
+        }
+        // Lets a track be edited in place, after which call invalidate()
+        Track &track(size_t i) { return tracks.tracks[i]; }
+
+        void invalidate()
+        {
+            contentChanged = true;
+            for (auto *n = this; n; n = n->parent)
+                n->dirty = true;
+        }
+        void setContentVersion(uint64_t v)
+        {
+            if (v != contentVersion)
+            {
+                contentVersion = v;
+                invalidate();
+            }
+        }
+
+      private:
+        friend struct LayoutTree;
+        std::array<juce::Component *, maxTracks> components{};
+        std::array<Node *, maxTracks> children{};
+        Node *parent{nullptr};
+
+        uint64_t contentVersion{0};
+        bool dirty{true}, contentChanged{true};
+        juce::Rectangle<int> placedAt;
+        Tracks::Rectangles<int> solved; // at the origin
+    };
+
+    // Nodes live as long as the tree; the first one made is the root
+    Node &node(Tracks::Orientation o = Tracks::HORIZONTAL)
+    {
+        auto &n = nodes.emplace_back();
+        n.orientation = o;
+        return n;
+    }
+
+    void apply(const juce::Rectangle<int> &bounds)
+    {
+        if (!nodes.empty())
+            place(nodes.front(), bounds);
+    }
+
+    /*
+     * How often nodes were solved, reused after a move, walked where they were only to
+     * reach an invalidated node below, or skipped outright
+     */
+    struct Stats
+    {
+        uint64_t solved{0}, translated{0}, descended{0}, skipped{0};
+    } stats;
+
+  private:
+    void place(Node &n, const juce::Rectangle<int> &r)
+    {
+        if (!n.dirty && r == n.placedAt)
+        {
+            stats.skipped++;
+            return;
+        }
+        if (!n.contentChanged && r == n.placedAt)
+        {
+            // Nothing here moved, so only the nodes below need placing
+            n.dirty = false;
+            stats.descended++;
+            for (size_t i = 0; i < n.solved.size(); ++i)
+                if (n.children[i])
+                    place(*n.children[i], n.solved[i].translated(r.getX(), r.getY()));
+            return;
+        }
+        if (n.contentChanged || r.getWidth() != n.placedAt.getWidth() ||
+            r.getHeight() != n.placedAt.getHeight())
+        {
+            n.solved = n.tracks.layout(r.withZeroOrigin(), n.orientation);
+            n.contentChanged = false;
+            stats.solved++;
+        }
+        else
+        {
+            stats.translated++;
+        }
+        n.placedAt = r;
+        n.dirty = false;
+
+        for (size_t i = 0; i < n.solved.size(); ++i)
+        {
+            auto tr = n.solved[i].translated(r.getX(), r.getY());
+            if (n.components[i])
+                n.components[i]->setBounds(tr);
+            if (n.children[i])
+                place(*n.children[i], tr);
+        }
+    }
+
+    std::deque<Node> nodes;
+};
 } // namespace sst::jucegui::style
 
 #endif // SST_JUCEGUI_LAYOUTS_H
@@ -20,6 +20,7 @@
 
 #include <string>
 #include <vector>
+#include <sst/jucegui/util/Footprint.h>
 #include "StyleSheet.h"
 #include "Settings.h"
 
@@ -52,7 +53,7 @@ struct StyleConsumer
         StyleSheet::extendInheritanceMap(customClass, styleClass);
     }
 
-    const StyleSheet::Class &getStyleClass()
+    const StyleSheet::Class &getStyleClass() const
     {
         if (customClass.cname[0] != 0)
             return customClass;
@@ -68,6 +69,21 @@ struct StyleConsumer
     }
     virtual void onStyleChanged() {}
 
+    /*
+     * Describe the bytes this instance costs. footprintOf in components/ComponentFootprint.h
+     * takes the name and size from describeFootprintObject, then asks this for the parts,
+     * so overrides call their base and add only what their own class holds.
+     */
+    virtual void describeFootprint(util::Footprint &f) const
+    {
+        f.addInline("customClass", sizeof(customClass));
+    }
+    // The name and size of the whole object. See SST_JUCEGUI_DECLARE_FOOTPRINT.
+    virtual void describeFootprintObject(util::Footprint &f) const
+    {
+        f.setObject<StyleConsumer>(styleClass.cname);
+    }
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StyleConsumer);
 
   private:
@@ -75,6 +91,17 @@ struct StyleConsumer
     const StyleSheet::Class &styleClass;
 };
 
+/*
+ * Names a component in footprints and sizes it as Type. Every component declares it
+ * once; a subclass which adds members should declare its own, or it is counted at the
+ * size of the class it derives from.
+ */
+#define SST_JUCEGUI_DECLARE_FOOTPRINT(Type, name)                                          \
+    void describeFootprintObject(::sst::jucegui::util::Footprint &f) const override        \
+    {                                                                                      \
+        f.setObject<Type>(name);                                                           \
+    }
+
 struct SettingsConsumer
 {
     SettingsConsumer() = default;
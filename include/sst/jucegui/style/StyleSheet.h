@@ -22,6 +22,10 @@
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <cassert>
 
+#ifndef SST_JUCEGUI_STYLE_STATS
+#define SST_JUCEGUI_STYLE_STATS 0
+#endif
+
 namespace sst::jucegui::style
 {
 struct StyleConsumer;
@@ -129,6 +133,32 @@ struct StyleSheet
     };
     static ptr_t getBuiltInStyleSheet(const BuiltInTypes &t);
 
+#if SST_JUCEGUI_STYLE_STATS
+    /*
+     * Built with SST_JUCEGUI_STYLE_STATS=1 (the CMake option of the same name) the built
+     * in sheets count every lookup by the class and property asked for, and how many
+     * base class hops it took to resolve. Hot pairs are where caching pays; deep ones,
+     * often custom classes from setCustomClass, are where to flatten a hierarchy. Like
+     * the lookups themselves this is for the message thread only.
+     */
+    struct LookupStat
+    {
+        std::string className, propertyName;
+        const char *kind; // getColour, hasColour, getFont or hasFont
+        uint64_t count{0}, totalHops{0};
+        uint32_t maxHops{0};
+    };
+    static std::vector<LookupStat> getLookupStats();
+    // The topN pairs by count and by hops, as text for a log
+    static std::string getLookupReport(size_t topN = 20);
+    static void resetLookupStats();
+
+  protected:
+    static void countLookup(const Class &c, const Property &p, const char *kind, uint32_t hops);
+
+  public:
+#endif
+
     friend struct StyleConsumer;
     friend struct Declaration;
 
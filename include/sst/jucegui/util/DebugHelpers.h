@@ -20,9 +20,10 @@
 
 #if DEBUG
 #include <iostream>
+#include "Logging.h"
 
-#define DBGOUT(x)                                                                                  \
-    std::cout << __FILE__ << ":" << __LINE__ << "|" << __func__ << "| " << x << std::endl;
+// Through the log sink, so a host can redirect it and a hot loop cannot flood the console
+#define DBGOUT(x) SST_JUCEGUI_LOG(VERBOSE, __func__ << "| " << x);
 
 #define DBGMARK DBGOUT("")
 #define DBGVAL(x) " " << (#x) << "=" << x
@@ -0,0 +1,94 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_UTIL_FOOTPRINT_H
+#define INCLUDE_SST_JUCEGUI_UTIL_FOOTPRINT_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sst::jucegui::util
+{
+/**
+ * The bytes one object costs: its own size, the members worth calling out inside that
+ * (inline parts, already counted in objectBytes) and what it owns on the heap. Heap
+ * figures are what the containers have reserved, and the size of any InlineCallback
+ * target too big to live inline; allocator overhead, juce::Component's own internals
+ * and the captures of std::function targets are not visible and not counted, so a heap
+ * total is a lower bound.
+ */
+struct Footprint
+{
+    struct Part
+    {
+        const char *what;
+        size_t bytes;
+        bool onHeap;
+    };
+
+    const char *typeName{"component"};
+    size_t objectBytes{0};
+    std::vector<Part> parts;
+
+    template <typename T> void setObject(const char *name)
+    {
+        typeName = name;
+        objectBytes = sizeof(T);
+    }
+    void addInline(const char *what, size_t bytes) { parts.push_back({what, bytes, false}); }
+    void addHeap(const char *what, size_t bytes)
+    {
+        if (bytes > 0)
+            parts.push_back({what, bytes, true});
+    }
+
+    size_t heapBytes() const
+    {
+        size_t res{0};
+        for (const auto &p : parts)
+            res += p.onHeap ? p.bytes : 0;
+        return res;
+    }
+    size_t totalBytes() const { return objectBytes + heapBytes(); }
+};
+
+// Zero while the characters fit in the string's small buffer
+inline size_t heapBytesOf(const std::string &s)
+{
+    auto d = reinterpret_cast<const char *>(s.data());
+    auto o = reinterpret_cast<const char *>(&s);
+    if (d >= o && d < o + sizeof(s))
+        return 0;
+    return s.capacity() + 1;
+}
+
+template <typename T> size_t heapBytesOf(const std::vector<T> &v)
+{
+    return v.capacity() * sizeof(T);
+}
+
+inline size_t heapBytesOf(const std::vector<std::string> &v)
+{
+    auto res = v.capacity() * sizeof(std::string);
+    for (const auto &s : v)
+        res += heapBytesOf(s);
+    return res;
+}
+} // namespace sst::jucegui::util
+
+#endif // SST_JUCEGUI_FOOTPRINT_H
@@ -0,0 +1,137 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_UTIL_GAPBUFFER_H
+#define INCLUDE_SST_JUCEGUI_UTIL_GAPBUFFER_H
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cassert>
+
+namespace sst::jucegui::util
+{
+/**
+ * GapBuffer is a random access sequence which keeps its free space as a gap at the
+ * position of the last edit. Inserting or erasing k elements at the gap costs O(k);
+ * an edit elsewhere first moves the gap there, which moves only the elements between
+ * the old and new positions. Edits in a tree view cluster around where the user is
+ * working, so opening and closing nodes stays proportional to the rows they add or
+ * remove rather than to the size of the table.
+ *
+ * Indexing is one comparison more than a vector. T must be default constructible and
+ * move assignable; vacated slots are reset to T{} so they release what they held.
+ */
+template <typename T> struct GapBuffer
+{
+    size_t size() const { return storage.size() - (gapEnd - gapStart); }
+    bool empty() const { return size() == 0; }
+
+    const T &operator[](size_t i) const
+    {
+        assert(i < size());
+        return storage[i < gapStart ? i : i + (gapEnd - gapStart)];
+    }
+    T &operator[](size_t i)
+    {
+        assert(i < size());
+        return storage[i < gapStart ? i : i + (gapEnd - gapStart)];
+    }
+
+    /**
+     * Insert n elements before position `at`. `make(i)` returns the i-th new element.
+     */
+    template <typename F> void insert(size_t at, size_t n, F &&make)
+    {
+        assert(at <= size());
+        moveGapTo(at);
+        reserveGap(n);
+        for (size_t i = 0; i < n; ++i)
+            storage[gapStart++] = make(i);
+    }
+
+    void push_back(T t)
+    {
+        moveGapTo(size());
+        reserveGap(1);
+        storage[gapStart++] = std::move(t);
+    }
+
+    void erase(size_t at, size_t n)
+    {
+        assert(at + n <= size());
+        moveGapTo(at);
+        for (size_t i = 0; i < n; ++i)
+            storage[gapEnd + i] = T{};
+        gapEnd += n;
+    }
+
+    void clear()
+    {
+        storage.clear();
+        gapStart = 0;
+        gapEnd = 0;
+    }
+
+  private:
+    void moveGapTo(size_t pos)
+    {
+        auto gl = gapEnd - gapStart;
+        if (gl == 0)
+        {
+            // nothing to move; and moving elements onto themselves would empty them
+            gapStart = pos;
+            gapEnd = pos;
+            return;
+        }
+        if (pos < gapStart)
+        {
+            std::move_backward(storage.begin() + pos, storage.begin() + gapStart,
+                               storage.begin() + gapEnd);
+            std::fill(storage.begin() + pos, storage.begin() + std::min(gapStart, pos + gl), T{});
+        }
+        else if (pos > gapStart)
+        {
+            auto n = pos - gapStart;
+            std::move(storage.begin() + gapEnd, storage.begin() + gapEnd + n,
+                      storage.begin() + gapStart);
+            std::fill(storage.begin() + std::max(gapEnd, pos), storage.begin() + gapEnd + n, T{});
+        }
+        gapStart = pos;
+        gapEnd = pos + gl;
+    }
+
+    void reserveGap(size_t n)
+    {
+        if (gapEnd - gapStart >= n)
+            return;
+
+        auto tail = storage.size() - gapEnd;
+        auto newSize = std::max({storage.size() * 2, size() + n, (size_t)16});
+        auto ns = std::vector<T>(newSize);
+        std::move(storage.begin(), storage.begin() + gapStart, ns.begin());
+        std::move(storage.begin() + gapEnd, storage.end(), ns.end() - tail);
+        storage = std::move(ns);
+        gapEnd = storage.size() - tail;
+    }
+
+    std::vector<T> storage;
+    size_t gapStart{0}, gapEnd{0};
+};
+} // namespace sst::jucegui::util
+
+#endif // SST_JUCEGUI_GAPBUFFER_H
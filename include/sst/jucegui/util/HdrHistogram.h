@@ -0,0 +1,109 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_UTIL_HDRHISTOGRAM_H
+#define INCLUDE_SST_JUCEGUI_UTIL_HDRHISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace sst::jucegui::util
+{
+/**
+ * A histogram of non negative integers in the style of HdrHistogram: values below
+ * 2^subBits are counted exactly and above that each power of two is split into
+ * 2^(subBits-1) equal buckets, so a percentile is within 1 / 2^(subBits-1) of the true
+ * value across the whole range. With the defaults that is 1.6% on anything up to 2^40,
+ * in a fixed array of about 2000 counts, and recording is a few shifts and an increment.
+ *
+ * Values past the range are counted in the last bucket. Not thread safe.
+ */
+template <int subBits = 7, int maxBits = 40> struct HdrHistogram
+{
+    static_assert(subBits >= 2 && maxBits > subBits && maxBits < 64);
+
+    static constexpr uint64_t full{uint64_t(1) << subBits}, half{full / 2};
+    static constexpr size_t bucketCount{full + (maxBits - subBits) * half};
+
+    static constexpr size_t indexFor(uint64_t v)
+    {
+        if (v < full)
+            return (size_t)v;
+        int msb{0};
+        for (auto t = v; t > 1; t >>= 1)
+            ++msb;
+        auto shift = msb - (subBits - 1);
+        auto idx = full + (shift - 1) * half + ((v >> shift) - half);
+        return std::min((size_t)idx, bucketCount - 1);
+    }
+    // The largest value which lands in bucket idx
+    static constexpr uint64_t highestIn(size_t idx)
+    {
+        if (idx < full)
+            return idx;
+        auto k = idx - full;
+        auto shift = k / half + 1;
+        auto top = k % half + half;
+        return ((top + 1) << shift) - 1;
+    }
+
+    void record(uint64_t v, uint64_t times = 1)
+    {
+        counts[indexFor(v)] += times;
+        total += times;
+        sum += v * times;
+        minValue = std::min(minValue, v);
+        maxValue = std::max(maxValue, v);
+    }
+
+    uint64_t count() const { return total; }
+    double mean() const { return total ? (double)sum / total : 0.0; }
+    uint64_t min() const { return total ? minValue : 0; }
+    uint64_t max() const { return maxValue; }
+
+    // The value at or below which pct percent of the recorded values lie, 0 if empty
+    uint64_t valueAtPercentile(double pct) const
+    {
+        if (total == 0)
+            return 0;
+        auto want = (uint64_t)(std::clamp(pct, 0.0, 100.0) / 100.0 * total + 0.5);
+        want = std::max(want, uint64_t(1));
+        uint64_t seen{0};
+        for (size_t i = 0; i < bucketCount; ++i)
+        {
+            seen += counts[i];
+            if (seen >= want)
+                return std::min(highestIn(i), maxValue);
+        }
+        return maxValue;
+    }
+
+    void reset()
+    {
+        counts.fill(0);
+        total = sum = maxValue = 0;
+        minValue = UINT64_MAX;
+    }
+
+  private:
+    std::array<uint64_t, bucketCount> counts{};
+    uint64_t total{0}, sum{0}, maxValue{0}, minValue{UINT64_MAX};
+};
+} // namespace sst::jucegui::util
+
+#endif // SST_JUCEGUI_HDRHISTOGRAM_H
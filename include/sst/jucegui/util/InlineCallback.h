@@ -0,0 +1,233 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_UTIL_INLINECALLBACK_H
+#define INCLUDE_SST_JUCEGUI_UTIL_INLINECALLBACK_H
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sst::jucegui::util
+{
+template <typename Sig, size_t capacity = 2 * sizeof(void *)> struct InlineCallback;
+
+/**
+ * A copyable callback for per widget hooks, assigned and called like a std::function
+ * but smaller: callables of up to capacity bytes (a lambda capturing two pointers, with
+ * the default) live in the object, next to one pointer to a static table for the type.
+ * Anything bigger goes to the heap as std::function would put it.
+ *
+ * Unlike std::function, calling an empty callback does nothing and returns R{}, so
+ * owners need not install empty lambdas to be safe to call, and an unset callback costs
+ * a null check rather than an indirect call. As with std::function, assigning an empty
+ * std::function or a null function or member pointer leaves the callback empty.
+ */
+template <typename R, typename... Args, size_t capacity> struct InlineCallback<R(Args...), capacity>
+{
+    InlineCallback() = default;
+    InlineCallback(std::nullptr_t) {}
+
+    template <typename F, typename D = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same_v<D, InlineCallback> &&
+                                          std::is_invocable_r_v<R, D &, Args...>>>
+    InlineCallback(F &&f)
+    {
+        emplace<D>(std::forward<F>(f));
+    }
+
+    InlineCallback(const InlineCallback &other) : table(other.table)
+    {
+        if (table)
+            table->manage(COPY, storage, const_cast<unsigned char *>(other.storage));
+    }
+    InlineCallback(InlineCallback &&other) noexcept : table(other.table)
+    {
+        if (table)
+            table->manage(MOVE, storage, other.storage);
+        other.table = nullptr;
+    }
+    ~InlineCallback() { reset(); }
+
+    InlineCallback &operator=(const InlineCallback &other)
+    {
+        if (this != &other)
+        {
+            InlineCallback tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+    InlineCallback &operator=(InlineCallback &&other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            table = other.table;
+            if (table)
+                table->manage(MOVE, storage, other.storage);
+            other.table = nullptr;
+        }
+        return *this;
+    }
+    InlineCallback &operator=(std::nullptr_t)
+    {
+        reset();
+        return *this;
+    }
+    template <typename F, typename D = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same_v<D, InlineCallback> &&
+                                          std::is_invocable_r_v<R, D &, Args...>>>
+    InlineCallback &operator=(F &&f)
+    {
+        reset();
+        emplace<D>(std::forward<F>(f));
+        return *this;
+    }
+
+    explicit operator bool() const { return table != nullptr; }
+    friend bool operator==(const InlineCallback &c, std::nullptr_t) { return !c; }
+    friend bool operator==(std::nullptr_t, const InlineCallback &c) { return !c; }
+    friend bool operator!=(const InlineCallback &c, std::nullptr_t) { return (bool)c; }
+    friend bool operator!=(std::nullptr_t, const InlineCallback &c) { return (bool)c; }
+
+    R operator()(Args... args) const
+    {
+        if (!table)
+        {
+            if constexpr (std::is_void_v<R>)
+                return;
+            else
+                return R{};
+        }
+        return table->invoke(const_cast<unsigned char *>(storage), std::forward<Args>(args)...);
+    }
+
+    // The bytes a callable too big to live in the object took on the heap, else zero
+    size_t heapBytes() const { return table ? table->heapBytes : 0; }
+
+    void reset()
+    {
+        if (table)
+            table->manage(DESTROY, storage, nullptr);
+        table = nullptr;
+    }
+
+  private:
+    enum Op
+    {
+        COPY,
+        MOVE,
+        DESTROY
+    };
+    struct Table
+    {
+        R (*invoke)(void *, Args &&...);
+        void (*manage)(Op, void *dst, void *src);
+        size_t heapBytes;
+    };
+
+    template <typename F>
+    static constexpr bool fitsInline = sizeof(F) <= capacity &&
+                                       alignof(F) <= alignof(void *) &&
+                                       std::is_nothrow_move_constructible_v<F>;
+
+    template <typename F> struct Model
+    {
+        static F *get(void *s)
+        {
+            if constexpr (fitsInline<F>)
+                return std::launder(reinterpret_cast<F *>(s));
+            else
+                return *reinterpret_cast<F **>(s);
+        }
+        static R invoke(void *s, Args &&...args)
+        {
+            if constexpr (std::is_void_v<R>)
+                std::invoke(*get(s), std::forward<Args>(args)...);
+            else
+                return std::invoke(*get(s), std::forward<Args>(args)...);
+        }
+        static void manage(Op op, void *dst, void *src)
+        {
+            switch (op)
+            {
+            case COPY:
+                if constexpr (fitsInline<F>)
+                    new (dst) F(*get(src));
+                else
+                    *reinterpret_cast<F **>(dst) = new F(*get(src));
+                break;
+            case MOVE:
+                if constexpr (fitsInline<F>)
+                {
+                    new (dst) F(std::move(*get(src)));
+                    get(src)->~F();
+                }
+                else
+                {
+                    *reinterpret_cast<F **>(dst) = get(src);
+                }
+                break;
+            case DESTROY:
+                if constexpr (fitsInline<F>)
+                    get(dst)->~F();
+                else
+                    delete get(dst);
+                break;
+            }
+        }
+        static constexpr Table table{&Model::invoke, &Model::manage,
+                                     fitsInline<F> ? 0 : sizeof(F)};
+    };
+
+    template <typename F> struct isStdFunction : std::false_type
+    {
+    };
+    template <typename S> struct isStdFunction<std::function<S>> : std::true_type
+    {
+    };
+
+    template <typename D, typename F> void emplace(F &&f)
+    {
+        if constexpr (std::is_pointer_v<D> || std::is_member_pointer_v<D>)
+        {
+            if (f == nullptr)
+                return;
+        }
+        else if constexpr (isStdFunction<D>::value)
+        {
+            if (!f)
+                return;
+        }
+
+        if constexpr (fitsInline<D>)
+            new (storage) D(std::forward<F>(f));
+        else
+            *reinterpret_cast<D **>(storage) = new D(std::forward<F>(f));
+        table = &Model<D>::table;
+    }
+
+    static_assert(capacity >= sizeof(void *));
+    alignas(void *) unsigned char storage[capacity];
+    const Table *table{nullptr};
+};
+} // namespace sst::jucegui::util
+
+#endif // SST_JUCEGUI_INLINECALLBACK_H
@@ -0,0 +1,150 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_UTIL_LOGGING_H
+#define INCLUDE_SST_JUCEGUI_UTIL_LOGGING_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+// The least severe level compiled in, and the default for setLogLevel
+#ifndef SST_JUCEGUI_LOG_COMPILED_LEVEL
+#if DEBUG
+#define SST_JUCEGUI_LOG_COMPILED_LEVEL VERBOSE
+#else
+#define SST_JUCEGUI_LOG_COMPILED_LEVEL INFO
+#endif
+#endif
+
+// Messages each log statement may emit per second
+#ifndef SST_JUCEGUI_LOG_PER_SECOND
+#define SST_JUCEGUI_LOG_PER_SECOND 10
+#endif
+
+namespace sst::jucegui::util
+{
+// Named to stay clear of the DEBUG and ERROR macros of JUCE and Windows
+enum class LogLevel : uint8_t
+{
+    VERBOSE,
+    INFO,
+    WARNING,
+    SEVERE,
+    SILENT
+};
+
+/**
+ * Where library diagnostics go. A host installs its own sink with setLogSink to route
+ * them into its log, or nullptr to drop them; the default writes lines to stderr without
+ * flushing. Sinks may be called from any thread.
+ *
+ * The path to a sink takes no locks: the sink and the level are atomics, and each log
+ * statement has its own rate limit, so a message repeated from a paint loop costs a few
+ * atomic operations per frame once its budget is spent. Statements below
+ * SST_JUCEGUI_LOG_COMPILED_LEVEL are compiled out, and the message is only formatted once
+ * a statement has passed the level and its limit.
+ */
+struct LogSink
+{
+    virtual ~LogSink() = default;
+    virtual void log(LogLevel level, const char *file, int line, const std::string &msg) = 0;
+};
+
+struct ConsoleLogSink : LogSink
+{
+    void log(LogLevel level, const char *file, int line, const std::string &msg) override
+    {
+        static constexpr const char *names[] = {"VERBOSE", "INFO", "WARNING", "SEVERE", ""};
+        fprintf(stderr, "%s:%d [%s] %s\n", file, line, names[(int)level], msg.c_str());
+    }
+};
+
+namespace logdetail
+{
+inline ConsoleLogSink consoleSink;
+inline std::atomic<LogSink *> sink{&consoleSink};
+inline std::atomic<LogLevel> level{LogLevel::SST_JUCEGUI_LOG_COMPILED_LEVEL};
+} // namespace logdetail
+
+inline void setLogSink(LogSink *s) { logdetail::sink = s; }
+inline LogSink *getLogSink() { return logdetail::sink; }
+inline void setLogLevel(LogLevel l) { logdetail::level = l; }
+inline LogLevel getLogLevel() { return logdetail::level; }
+
+/*
+ * Lets through at most perSecond messages from one log statement each second, and
+ * counts the rest so the next message through can say how many were dropped.
+ */
+template <uint32_t perSecond> struct LogRateLimit
+{
+    std::atomic<int64_t> windowStart{0};
+    std::atomic<uint32_t> inWindow{0}, dropped{0};
+
+    bool allow()
+    {
+        auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                       .count();
+        auto ws = windowStart.load(std::memory_order_relaxed);
+        if (now - ws >= 1000 && windowStart.compare_exchange_strong(ws, now))
+            inWindow = 0;
+        if (inWindow.fetch_add(1, std::memory_order_relaxed) < perSecond)
+            return true;
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    // How many were dropped since the last message through
+    uint32_t takeDropped() { return dropped.exchange(0, std::memory_order_relaxed); }
+};
+
+inline bool shouldLog(LogLevel l) { return l >= logdetail::level.load(std::memory_order_relaxed); }
+
+inline void emitLog(LogLevel l, const char *file, int line, std::string msg, uint32_t dropped)
+{
+    auto s = logdetail::sink.load(std::memory_order_acquire);
+    if (!s)
+        return;
+    if (dropped > 0)
+        msg += " (" + std::to_string(dropped) + " similar dropped)";
+    s->log(l, file, line, msg);
+}
+} // namespace sst::jucegui::util
+
+// SST_JUCEGUI_LOG(WARNING, "No colour for " << c.cname);
+#define SST_JUCEGUI_LOG(lev, x)                                                                    \
+    do                                                                                             \
+    {                                                                                              \
+        using sstJuceguiLogLevel = ::sst::jucegui::util::LogLevel;                                 \
+        if constexpr (sstJuceguiLogLevel::lev >=                                                   \
+                      sstJuceguiLogLevel::SST_JUCEGUI_LOG_COMPILED_LEVEL)                          \
+        {                                                                                          \
+            static ::sst::jucegui::util::LogRateLimit<SST_JUCEGUI_LOG_PER_SECOND> limit;           \
+            if (::sst::jucegui::util::shouldLog(sstJuceguiLogLevel::lev) && limit.allow())         \
+            {                                                                                      \
+                std::ostringstream sstJuceguiLogStream;                                            \
+                sstJuceguiLogStream << x;                                                          \
+                ::sst::jucegui::util::emitLog(sstJuceguiLogLevel::lev, __FILE__, __LINE__,         \
+                                              sstJuceguiLogStream.str(), limit.takeDropped());     \
+            }                                                                                      \
+        }                                                                                          \
+    } while (0)
+
+#endif // SST_JUCEGUI_LOGGING_H
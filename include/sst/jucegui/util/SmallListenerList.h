@@ -0,0 +1,226 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#ifndef INCLUDE_SST_JUCEGUI_UTIL_SMALLLISTENERLIST_H
+#define INCLUDE_SST_JUCEGUI_UTIL_SMALLLISTENERLIST_H
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
+namespace sst::jucegui::util
+{
+/**
+ * SmallListenerList is a set-like container of listener pointers which stores
+ * up to N entries inline and only goes to the heap beyond that. Almost every data
+ * source has one or two listeners, so this keeps a parameter free of per-listener
+ * heap nodes and keeps a notification pass on a single cache line.
+ *
+ * It is also safe to add or remove listeners while iterating, which happens when
+ * a dataChanged callback rebuilds a piece of UI. A remove during iteration leaves
+ * a hole which iteration skips and which is compacted when the last live iterator
+ * goes away; an add during iteration appends and is visited by that iteration.
+ *
+ * ```
+ * for (auto *l : guilisteners)
+ *     l->dataChanged();
+ * ```
+ *
+ * @tparam T the listener type. The list stores T *.
+ * @tparam N the inline capacity.
+ */
+template <typename T, uint32_t N = 2> struct SmallListenerList
+{
+    SmallListenerList() = default;
+    SmallListenerList(const SmallListenerList &other) { *this = other; }
+    SmallListenerList &operator=(const SmallListenerList &other)
+    {
+        if (this == &other)
+            return *this;
+        clear();
+        for (uint32_t i = 0; i < other.count; ++i)
+            if (other.data()[i])
+                add(other.data()[i]);
+        return *this;
+    }
+    ~SmallListenerList() { delete[] heap; }
+
+    /**
+     * Add a listener. Adding a listener which is already present is a no-op.
+     */
+    void add(T *l)
+    {
+        if (!l || contains(l))
+            return;
+
+        if (count == capacity())
+            grow();
+        data()[count++] = l;
+    }
+
+    /**
+     * Remove a listener. Removing a listener which is not present is a no-op.
+     */
+    void remove(T *l)
+    {
+        auto d = data();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (d[i] == l)
+            {
+                if (iterating > 0)
+                {
+                    d[i] = nullptr;
+                    hasHoles = true;
+                }
+                else
+                {
+                    std::memmove(d + i, d + i + 1, (count - i - 1) * sizeof(T *));
+                    count--;
+                }
+                return;
+            }
+        }
+    }
+
+    bool contains(const T *l) const
+    {
+        auto d = data();
+        for (uint32_t i = 0; i < count; ++i)
+            if (d[i] == l)
+                return true;
+        return false;
+    }
+
+    uint32_t size() const
+    {
+        uint32_t res{0};
+        auto d = data();
+        for (uint32_t i = 0; i < count; ++i)
+            res += (d[i] != nullptr);
+        return res;
+    }
+    bool empty() const { return size() == 0; }
+
+    void clear()
+    {
+        if (iterating > 0)
+        {
+            auto d = data();
+            for (uint32_t i = 0; i < count; ++i)
+                d[i] = nullptr;
+            hasHoles = count > 0;
+            return;
+        }
+        count = 0;
+        hasHoles = false;
+    }
+
+    /*
+     * The iterator holds the list open for structural change; removes while any
+     * iterator is alive only null out their slot. The count is re-read on every
+     * step so listeners appended mid-iteration are visited.
+     */
+    struct iterator
+    {
+        iterator(SmallListenerList *l, uint32_t i, bool e) : list(l), idx(i), isEnd(e)
+        {
+            if (!isEnd)
+            {
+                list->iterating++;
+                skipHoles();
+            }
+        }
+        iterator(const iterator &other) : list(other.list), idx(other.idx), isEnd(other.isEnd)
+        {
+            if (!isEnd)
+                list->iterating++;
+        }
+        iterator &operator=(const iterator &) = delete;
+        ~iterator()
+        {
+            if (!isEnd)
+                list->doneIterating();
+        }
+
+        T *operator*() const { return list->data()[idx]; }
+        iterator &operator++()
+        {
+            idx++;
+            skipHoles();
+            return *this;
+        }
+        bool operator!=(const iterator &other) const { return done() != other.done(); }
+        bool operator==(const iterator &other) const { return done() == other.done(); }
+
+      private:
+        bool done() const { return isEnd || idx >= list->count; }
+        void skipHoles()
+        {
+            while (idx < list->count && list->data()[idx] == nullptr)
+                idx++;
+        }
+
+        SmallListenerList *list;
+        uint32_t idx;
+        bool isEnd;
+    };
+
+    iterator begin() { return iterator(this, 0, false); }
+    iterator end() { return iterator(this, 0, true); }
+
+  private:
+    T **data() { return heap ? heap : inlineStore; }
+    T *const *data() const { return heap ? heap : inlineStore; }
+    uint32_t capacity() const { return heap ? heapCapacity : N; }
+
+    void grow()
+    {
+        auto nc = capacity() * 2;
+        auto nh = new T *[nc];
+        std::memcpy(nh, data(), count * sizeof(T *));
+        delete[] heap;
+        heap = nh;
+        heapCapacity = nc;
+    }
+
+    void doneIterating()
+    {
+        assert(iterating > 0);
+        iterating--;
+        if (iterating == 0 && hasHoles)
+        {
+            auto d = data();
+            uint32_t w{0};
+            for (uint32_t r = 0; r < count; ++r)
+                if (d[r])
+                    d[w++] = d[r];
+            count = w;
+            hasHoles = false;
+        }
+    }
+
+    T *inlineStore[N]{};
+    T **heap{nullptr};
+    uint32_t heapCapacity{0};
+    uint32_t count{0};
+    uint16_t iterating{0};
+    bool hasHoles{false};
+};
+} // namespace sst::jucegui::util
+
+#endif // SST_JUCEGUI_SMALLLISTENERLIST_H
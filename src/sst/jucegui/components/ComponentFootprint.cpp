@@ -0,0 +1,88 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#include <sst/jucegui/components/ComponentFootprint.h>
+#include <sst/jucegui/style/StyleAndSettingsConsumer.h>
+
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+
+namespace sst::jucegui::components
+{
+util::Footprint footprintOf(const juce::Component &c)
+{
+    util::Footprint f;
+    if (auto sc = dynamic_cast<const style::StyleConsumer *>(&c))
+    {
+        sc->describeFootprintObject(f);
+        sc->describeFootprint(f);
+    }
+    else
+        f.setObject<juce::Component>("juce::Component");
+    f.addHeap("children", c.getNumChildComponents() * sizeof(juce::Component *));
+    return f;
+}
+
+TreeFootprint footprintOfTree(const juce::Component &root)
+{
+    TreeFootprint res;
+    std::unordered_map<std::string, size_t> index;
+
+    std::function<void(const juce::Component &)> rec;
+    rec = [&](const juce::Component &c) {
+        auto f = footprintOf(c);
+        auto [it, isNew] = index.emplace(f.typeName, res.byType.size());
+        if (isNew)
+            res.byType.push_back({f.typeName});
+        auto &t = res.byType[it->second];
+        t.count++;
+        t.objectBytes += f.objectBytes;
+        t.heapBytes += f.heapBytes();
+        res.components++;
+        res.objectBytes += f.objectBytes;
+        res.heapBytes += f.heapBytes();
+
+        for (int i = 0; i < c.getNumChildComponents(); ++i)
+            rec(*c.getChildComponent(i));
+    };
+    rec(root);
+
+    std::sort(res.byType.begin(), res.byType.end(),
+              [](const auto &a, const auto &b) { return a.totalBytes() > b.totalBytes(); });
+    return res;
+}
+
+std::string TreeFootprint::getReport() const
+{
+    std::ostringstream oss;
+    oss << components << " components, " << totalBytes() << " bytes (" << objectBytes
+        << " in objects, " << heapBytes << " on the heap)\n";
+    oss << std::left << std::setw(32) << "type" << std::right << std::setw(8) << "count"
+        << std::setw(12) << "bytes" << std::setw(12) << "each" << std::setw(12) << "heap"
+        << "\n";
+    for (const auto &t : byType)
+    {
+        oss << std::left << std::setw(32) << t.typeName << std::right << std::setw(8) << t.count
+            << std::setw(12) << t.totalBytes() << std::setw(12) << t.totalBytes() / t.count
+            << std::setw(12) << t.heapBytes << "\n";
+    }
+    return oss.str();
+}
+} // namespace sst::jucegui::components
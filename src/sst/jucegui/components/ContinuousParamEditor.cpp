@@ -19,11 +19,192 @@
 
 namespace sst::jucegui::components
 {
+struct ContinuousParamEditor::ModulationWaker : FrameScheduler::Client
+{
+    static ModulationWaker &get()
+    {
+        static ModulationWaker instance;
+        return instance;
+    }
+    ~ModulationWaker() { FrameScheduler::cancelFrames(this); }
+
+    void add(ContinuousParamEditor *e)
+    {
+        sleepers.add(e);
+        FrameScheduler::getInstance().requestFrames(this);
+    }
+    void remove(ContinuousParamEditor *e) { sleepers.remove(e); }
+
+    // One atomic load a frame however many editors sleep, until some feed is pushed
+    bool onFrame(double) override
+    {
+        auto seq = data::LiveModulationFeed::getWakeSequence();
+        if (seq != seenSequence)
+        {
+            seenSequence = seq;
+            for (auto *e : sleepers)
+            {
+                // A hidden editor leaves for its ShowWatcher, so only shown ones stay here
+                auto feed = e->source ? e->source->getLiveModulationFeed() : nullptr;
+                if (!feed || !e->isShowing() || !feed->markReaderIdle(e->lastDrawnModulationCount))
+                    e->wakeForModulation();
+            }
+        }
+        return !sleepers.empty();
+    }
+
+    util::SmallListenerList<ContinuousParamEditor, 8> sleepers;
+    uint32_t seenSequence{data::LiveModulationFeed::getWakeSequence()};
+};
+
+/*
+ * Hears the editor or any of its parents being shown or hidden, or put on screen. Made
+ * the first time the editor is found hidden and kept after, as it may be in the middle
+ * of a callback when the editor wakes.
+ */
+struct ContinuousParamEditor::ShowWatcher : juce::ComponentMovementWatcher
+{
+    explicit ShowWatcher(ContinuousParamEditor &e) : juce::ComponentMovementWatcher(&e), editor(e)
+    {
+    }
+    void componentVisibilityChanged() override { editor.wakeForModulation(); }
+    void componentPeerChanged() override { editor.wakeForModulation(); }
+    void componentMovedOrResized(bool, bool) override {}
+
+    ContinuousParamEditor &editor;
+};
+
 ContinuousParamEditor::ContinuousParamEditor(Direction dir) : direction(dir) {}
-ContinuousParamEditor::~ContinuousParamEditor() = default;
+ContinuousParamEditor::~ContinuousParamEditor()
+{
+    FrameScheduler::cancelFrames(this);
+    if (modulationAsleep)
+        ModulationWaker::get().remove(this);
+}
+
+void ContinuousParamEditor::wakeForModulation()
+{
+    if (modulationAsleep)
+    {
+        modulationAsleep = false;
+        ModulationWaker::get().remove(this);
+    }
+    auto feed = source ? source->getLiveModulationFeed() : nullptr;
+    if (!feed)
+        return;
+    if (!isShowing())
+    {
+        // Pushes to a hidden editor's feed wake nothing; being shown does. A parent being
+        // shown sends no visibilityChanged here, so the watcher listens to them all.
+        if (!showWatcher)
+            showWatcher = std::make_unique<ShowWatcher>(*this);
+        return;
+    }
+    FrameScheduler::getInstance().requestFrames(this);
+}
+
+bool ContinuousParamEditor::sleepForModulation(const data::LiveModulationFeed *feed)
+{
+    if (!feed->markReaderIdle(lastDrawnModulationCount))
+        return false;
+    if (!modulationAsleep)
+    {
+        modulationAsleep = true;
+        ModulationWaker::get().add(this);
+    }
+    return true;
+}
+
+void ContinuousParamEditor::dataChanged()
+{
+    if (source && !settingValue && mouseMode != DRAG && source->getDisplaySmoothingTime() > 0)
+    {
+        auto now = FrameScheduler::nowMs();
+        displayInterpolator.retarget(source->getValue01(), now,
+                                     source->getDisplaySmoothingTime() * 1000.0);
+        if (!displayInterpolator.isSettled(now))
+        {
+            displayAnimating = true;
+            FrameScheduler::getInstance().requestFrames(this);
+        }
+    }
+    else
+    {
+        displayAnimating = false;
+        if (source)
+            displayInterpolator.to = source->getValue01();
+    }
+    if (source && source->getLiveModulationFeed())
+        wakeForModulation();
+    repaint();
+}
+
+void ContinuousParamEditor::onSourceChanged()
+{
+    displayAnimating = false;
+    displayInterpolator = DisplayInterpolator();
+    lastDrawnModulationCount = 0;
+    wakeForModulation();
+}
+
+bool ContinuousParamEditor::onFrame(double nowMs)
+{
+    auto feed = source ? source->getLiveModulationFeed() : nullptr;
+    if (!displayAnimating && !feed)
+        return false;
+
+    bool needsRepaint = displayAnimating;
+    if (displayInterpolator.isSettled(nowMs))
+        displayAnimating = false;
+
+    auto pollFeed = false;
+    if (feed)
+    {
+        // Decimate the feed to the frame rate: one cheap read per frame and a repaint
+        // only if something was pushed since we last drew. A quiet feed stops being
+        // read until a push wakes it, and a hidden editor until it is shown.
+        auto wc = feed->getWriteCount();
+        auto moved = wc != lastDrawnModulationCount;
+        needsRepaint = needsRepaint || moved;
+        lastDrawnModulationCount = wc;
+        if (!isShowing())
+            wakeForModulation();
+        else
+            pollFeed = moved || !sleepForModulation(feed);
+    }
+
+    if (needsRepaint && isShowing())
+        repaint();
+    return displayAnimating || pollFeed;
+}
+
+int ContinuousParamEditor::getLiveModulationTrail(float *into, int n)
+{
+    auto feed = source ? source->getLiveModulationFeed() : nullptr;
+    if (!feed || n <= 0)
+        return 0;
+
+    // Spread the trail over the whole ring, always ending on the newest sample
+    float ring[data::LiveModulationFeed::ringSize];
+    auto rn = (int)feed->copyRecent(ring, data::LiveModulationFeed::ringSize);
+    n = std::min(n, rn);
+    for (int i = 0; i < n; ++i)
+        into[n - 1 - i] = ring[rn - 1 - (i * rn) / n];
+    return n;
+}
+
+float ContinuousParamEditor::getDisplayValue01()
+{
+    if (!source)
+        return 0.f;
+    if (displayAnimating)
+        return displayInterpolator.valueAt(FrameScheduler::nowMs());
+    return source->getValue01();
+}
 
 void ContinuousParamEditor::mouseDown(const juce::MouseEvent &e)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseDown");
     if (e.mods.isPopupMenu())
     {
         mouseMode = POPUP;
@@ -38,37 +219,41 @@ void ContinuousParamEditor::mouseDown(const juce::MouseEvent &e)
         return;
 
     mouseMode = DRAG;
-    onBeginEdit();
+    beginEdit();
+    // Values are dragged in the 0..1 space of the source mapping
     if (isEditingMod)
         mouseDownV0 = source->getModulationValuePM1();
     else
-        mouseDownV0 = source->getValue();
+        mouseDownV0 = source->getValue01();
     mouseDownY0 = e.position.y;
     mouseDownX0 = e.position.x;
 }
 void ContinuousParamEditor::mouseUp(const juce::MouseEvent &e)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseUp");
     if (source->isHidden())
         return;
 
     if (mouseMode == DRAG)
-        onEndEdit();
+        endEdit();
     mouseMode = NONE;
 }
 
 void ContinuousParamEditor::mouseDoubleClick(const juce::MouseEvent &e)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseDoubleClick");
     if (source->isHidden())
         return;
-    onBeginEdit();
-    source->setValueFromGUI(source->getDefaultValue());
-    onEndEdit();
+    beginEdit();
+    setValueFromEditor(source->getDefaultValue());
+    endEdit();
 
     repaint();
 }
 
 void ContinuousParamEditor::mouseDrag(const juce::MouseEvent &e)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseDrag");
     if (source->isHidden())
         return;
 
@@ -78,8 +263,8 @@ void ContinuousParamEditor::mouseDrag(const juce::MouseEvent &e)
     float dy = -(e.position.y - mouseDownY0);
     float dx = (e.position.x - mouseDownX0);
     float d = 0;
-    float minForScaling = source->getMin();
-    float maxForScaling = source->getMax();
+    float minForScaling = 0.f;
+    float maxForScaling = 1.f;
     if (isEditingMod)
     {
         if (source->isModulationBipolar())
@@ -109,8 +294,8 @@ void ContinuousParamEditor::mouseDrag(const juce::MouseEvent &e)
     }
     else
     {
-        auto vn = std::clamp(mouseDownV0 + d, source->getMin(), source->getMax());
-        source->setValueFromGUI(vn);
+        auto vn = std::clamp(mouseDownV0 + d, 0.f, 1.f);
+        setValueFromEditor(source->value01ToValue(vn));
         mouseDownV0 = vn;
     }
     mouseDownX0 = e.position.x;
@@ -121,12 +306,13 @@ void ContinuousParamEditor::mouseDrag(const juce::MouseEvent &e)
 void ContinuousParamEditor::mouseWheelMove(const juce::MouseEvent &e,
                                            const juce::MouseWheelDetails &wheel)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseWheelMove");
     if (source->isHidden())
         return;
 
     if (fabs(wheel.deltaY) < 0.0001)
         return;
-    onBeginEdit();
+    beginEdit();
 
     if (isEditingMod)
     {
@@ -141,14 +327,20 @@ void ContinuousParamEditor::mouseWheelMove(const juce::MouseEvent &e,
     else
     {
         // fixme - callibration and sharing
-        auto d = (wheel.isReversed ? -1 : 1) * wheel.deltaY * (source->getMax() - source->getMin());
+        auto d = (wheel.isReversed ? -1 : 1) * wheel.deltaY;
         if (e.mods.isShiftDown())
             d = d * 0.1;
 
-        auto vn = std::clamp(source->getValue() + d, source->getMin(), source->getMax());
-        source->setValueFromGUI(vn);
+        auto vn = std::clamp(source->getValue01() + d, 0.f, 1.f);
+        setValueFromEditor(source->value01ToValue(vn));
     }
-    onEndEdit();
+    endEdit();
     repaint();
 }
+
+void ContinuousParamEditor::describeEditorFootprint(util::Footprint &f) const
+{
+    describeEditableFootprint(f);
+    f.addInline("displayInterpolator", sizeof(displayInterpolator));
+}
 } // namespace sst::jucegui::components
\ No newline at end of file
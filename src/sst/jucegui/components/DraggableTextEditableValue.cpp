@@ -44,13 +44,19 @@ void DraggableTextEditableValue::setFromEditor()
 {
     jassert(underlyingEditor->isVisible());
     auto t = underlyingEditor->getText();
+    auto ov = source->getValue();
+    beginEdit();
     source->setValueAsString(t.toStdString());
+    if (editJournal)
+        editJournal->recordEdit(source, ov, source->getValue());
+    endEdit();
     underlyingEditor->setVisible(false);
     repaint();
 }
 
 void DraggableTextEditableValue::paint(juce::Graphics &g)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("paint");
     if (underlyingEditor->isVisible())
     {
         g.setColour(getColour(Styles::onbgcol));
@@ -81,27 +87,35 @@ void DraggableTextEditableValue::paint(juce::Graphics &g)
 
 void DraggableTextEditableValue::mouseDown(const juce::MouseEvent &e)
 {
-    onBeginEdit();
-    valueOnMouseDown = source->getValue();
+    SST_JUCEGUI_PROFILE_SCOPE("mouseDown");
+    beginEdit();
+    valueOnMouseDown = source->getValue01();
+}
+void DraggableTextEditableValue::mouseUp(const juce::MouseEvent &e)
+{
+    SST_JUCEGUI_PROFILE_SCOPE("mouseUp");
+    endEdit();
 }
-void DraggableTextEditableValue::mouseUp(const juce::MouseEvent &e) { onEndEdit(); }
 void DraggableTextEditableValue::mouseDrag(const juce::MouseEvent &e)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseDrag");
     auto d = e.getDistanceFromDragStartY();
     auto fac = 0.5f * (e.mods.isShiftDown() ? 0.1f : 1.f);
-    auto nv = valueOnMouseDown - fac * d * source->getFineQuantizedStepSize();
-    nv = std::clamp(nv, source->getMin(), source->getMax());
-    source->setValueFromGUI(nv);
+    auto step01 = source->getFineQuantizedStepSize() / (source->getMax() - source->getMin());
+    auto nv = std::clamp(valueOnMouseDown - fac * d * step01, 0.f, 1.f);
+    setValueFromGUIJournaled(source, source->value01ToValue(nv));
     repaint();
 }
 void DraggableTextEditableValue::mouseWheelMove(const juce::MouseEvent &event,
                                                 const juce::MouseWheelDetails &wheel)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseWheelMove");
     DBGOUT("IMPLEMENT MOUSE WHEEL");
 };
 
 void DraggableTextEditableValue::mouseDoubleClick(const juce::MouseEvent &e)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseDoubleClick");
     underlyingEditor->setText(source->getValueAsString());
     underlyingEditor->setVisible(true);
     underlyingEditor->selectAll();
@@ -120,5 +134,17 @@ void DraggableTextEditableValue::onStyleChanged()
     underlyingEditor->setIndents(0, 0);
     underlyingEditor->setJustification(juce::Justification::centred);
 }
-void DraggableTextEditableValue::resized() { underlyingEditor->setBounds(getLocalBounds()); }
+void DraggableTextEditableValue::resized()
+{
+    SST_JUCEGUI_PROFILE_SCOPE("resized");
+    underlyingEditor->setBounds(getLocalBounds());
+}
+
+void DraggableTextEditableValue::describeFootprint(util::Footprint &f) const
+{
+    StyleConsumer::describeFootprint(f);
+    describeEditableFootprint(f);
+    if (underlyingEditor)
+        f.addHeap("underlyingEditor", sizeof(juce::TextEditor));
+}
 } // namespace sst::jucegui::components
\ No newline at end of file
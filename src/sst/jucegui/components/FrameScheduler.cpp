@@ -0,0 +1,73 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#include <sst/jucegui/components/FrameScheduler.h>
+#include <sst/jucegui/components/FrameStats.h>
+
+namespace sst::jucegui::components
+{
+static FrameScheduler *frameSchedulerInstance{nullptr};
+
+FrameScheduler &FrameScheduler::getInstance()
+{
+    if (!frameSchedulerInstance)
+        frameSchedulerInstance = new FrameScheduler();
+    return *frameSchedulerInstance;
+}
+
+FrameScheduler::~FrameScheduler()
+{
+    stopTimer();
+    frameSchedulerInstance = nullptr;
+}
+
+void FrameScheduler::cancelFrames(Client *c)
+{
+    if (frameSchedulerInstance)
+        frameSchedulerInstance->clients.remove(c);
+}
+
+void FrameScheduler::requestFrames(Client *c)
+{
+    clients.add(c);
+    if (!isTimerRunning())
+        startTimerHz(frameRateHz);
+}
+
+void FrameScheduler::setFrameRateHz(int hz)
+{
+    frameRateHz = std::max(hz, 1);
+    if (isTimerRunning())
+        startTimerHz(frameRateHz);
+}
+
+void FrameScheduler::timerCallback()
+{
+    auto now = nowMs();
+    auto fs = FrameStats::getActive();
+    for (auto *c : clients)
+    {
+        if (fs)
+            fs->noteRepaintRequest();
+        if (!c->onFrame(now))
+            clients.remove(c);
+    }
+
+    if (clients.empty())
+        stopTimer();
+}
+} // namespace sst::jucegui::components
@@ -0,0 +1,157 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#include <sst/jucegui/components/FrameStats.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+namespace sst::jucegui::components
+{
+FrameStats::FrameStats(double budgetMs) { setBudgetMs(budgetMs); }
+
+FrameStats::~FrameStats()
+{
+    auto self = this;
+    active.compare_exchange_strong(self, nullptr);
+}
+
+int64_t FrameStats::nowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void FrameStats::beginFrame()
+{
+    if (inFrame)
+        return;
+    inFrame = true;
+    frameStartUs = nowUs();
+}
+
+void FrameStats::notePaint(const char *styleClass, int64_t durationUs)
+{
+    // The window's own paint is skipped when opaque children cover the whole dirty area
+    if (!inFrame)
+    {
+        inFrame = true;
+        frameStartUs = nowUs() - durationUs;
+    }
+    paintsThisFrame++;
+
+    auto p = std::find_if(paintersThisFrame.begin(), paintersThisFrame.end(),
+                          [styleClass](const auto &fp) {
+                              return fp.styleClass == styleClass ||
+                                     std::strcmp(fp.styleClass, styleClass) == 0;
+                          });
+    if (p == paintersThisFrame.end())
+        paintersThisFrame.push_back({styleClass, 1, durationUs});
+    else
+    {
+        p->count++;
+        p->durationUs += durationUs;
+    }
+}
+
+void FrameStats::endFrame()
+{
+    if (!inFrame)
+        return;
+    inFrame = false;
+
+    auto duration = std::max(nowUs() - frameStartUs, int64_t(0));
+    frameUs.record((uint64_t)duration);
+    paintsPerFrame.record(paintsThisFrame);
+    repaintsPerFrame.record(repaintsThisFrame);
+
+    if (duration > budgetUs)
+    {
+        slowFrameCount++;
+        std::sort(paintersThisFrame.begin(), paintersThisFrame.end(),
+                  [](const auto &a, const auto &b) { return a.durationUs > b.durationUs; });
+
+        SlowFrame sf;
+        sf.frame = frameUs.count();
+        sf.durationUs = duration;
+        sf.paints = paintsThisFrame;
+        sf.repaintRequests = repaintsThisFrame;
+        for (const auto &fp : paintersThisFrame)
+            sf.painters.push_back({fp.styleClass, fp.count, fp.durationUs});
+
+        if (slowFrames.size() == maxSlowFramesKept)
+            slowFrames.pop_front();
+        slowFrames.push_back(std::move(sf));
+        if (onSlowFrame)
+            onSlowFrame(slowFrames.back());
+    }
+
+    paintsThisFrame = 0;
+    repaintsThisFrame = 0;
+    paintersThisFrame.clear();
+}
+
+void FrameStats::reset()
+{
+    frameUs.reset();
+    paintsPerFrame.reset();
+    repaintsPerFrame.reset();
+    slowFrameCount = 0;
+    slowFrames.clear();
+    inFrame = false;
+    paintsThisFrame = 0;
+    repaintsThisFrame = 0;
+    paintersThisFrame.clear();
+}
+
+std::string FrameStats::getReport(size_t paintersPerSlowFrame) const
+{
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2);
+    oss << "frames " << getFrameCount() << ", over the " << getBudgetMs() << "ms budget "
+        << slowFrameCount << "\n";
+
+    auto line = [&oss](const char *name, const auto &h, double scale) {
+        oss << std::left << std::setw(16) << name << std::right << " mean " << h.mean() * scale
+            << " p50 " << h.valueAtPercentile(50) * scale << " p90 "
+            << h.valueAtPercentile(90) * scale << " p99 " << h.valueAtPercentile(99) * scale
+            << " max " << h.max() * scale << "\n";
+    };
+    line("frame ms", frameUs, 0.001);
+    line("paints/frame", paintsPerFrame, 1.0);
+    line("repaints/frame", repaintsPerFrame, 1.0);
+
+    for (const auto &sf : slowFrames)
+    {
+        oss << "slow frame " << sf.frame << " " << sf.durationUs / 1000.0 << "ms, " << sf.paints
+            << " paints:";
+        auto n = std::min(paintersPerSlowFrame, sf.painters.size());
+        for (size_t i = 0; i < n; ++i)
+        {
+            const auto &p = sf.painters[i];
+            oss << (i ? ", " : " ") << p.styleClass << " x" << p.count << " "
+                << p.durationUs / 1000.0 << "ms";
+        }
+        oss << "\n";
+    }
+    return oss.str();
+}
+} // namespace sst::jucegui::components
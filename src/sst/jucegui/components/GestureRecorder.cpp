@@ -0,0 +1,328 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#include <sst/jucegui/components/GestureRecorder.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+
+namespace sst::jucegui::components
+{
+namespace
+{
+constexpr const char *kindNames[] = {"down", "drag",         "up",    "move", "enter",
+                                     "exit", "double-click", "wheel", "key"};
+} // namespace
+
+std::string GestureRecording::toString() const
+{
+    std::ostringstream oss;
+    oss << std::setprecision(9);
+    for (const auto &g : gestures)
+    {
+        oss << kindNames[g.kind] << " " << g.timeMs << " ";
+        if (g.path.empty())
+            oss << "-";
+        for (size_t i = 0; i < g.path.size(); ++i)
+            oss << (i ? "." : "") << g.path[i];
+        oss << " " << g.x << " " << g.y << " " << g.mods << " " << g.clicks << " "
+            << g.wheelDeltaX << " " << g.wheelDeltaY << " " << g.wheelReversed << " "
+            << g.wheelSmooth << " " << g.keyCode << " " << g.keyChar << "\n";
+    }
+    return oss.str();
+}
+
+bool GestureRecording::fromString(const std::string &s)
+{
+    gestures.clear();
+    std::istringstream lines(s);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        if (line.empty())
+            continue;
+
+        std::istringstream iss(line);
+        std::string kind, path;
+        Gesture g;
+        iss >> kind >> g.timeMs >> path >> g.x >> g.y >> g.mods >> g.clicks >> g.wheelDeltaX >>
+            g.wheelDeltaY >> g.wheelReversed >> g.wheelSmooth >> g.keyCode >> g.keyChar;
+
+        auto k = std::find(std::begin(kindNames), std::end(kindNames), kind);
+        if (!iss || k == std::end(kindNames))
+        {
+            gestures.clear();
+            return false;
+        }
+        g.kind = (Gesture::Kind)(k - std::begin(kindNames));
+
+        if (path != "-")
+        {
+            std::istringstream ps(path);
+            std::string idx;
+            while (std::getline(ps, idx, '.'))
+                g.path.push_back(std::atoi(idx.c_str()));
+        }
+        gestures.push_back(std::move(g));
+    }
+    return true;
+}
+
+GestureRecorder::GestureRecorder(juce::Component &r) : root(r) {}
+
+GestureRecorder::~GestureRecorder() { stop(); }
+
+void GestureRecorder::start()
+{
+    if (recording)
+        return;
+    recording = true;
+    result.gestures.clear();
+    startMs = juce::Time::getMillisecondCounterHiRes();
+    root.addMouseListener(this, true);
+
+    std::function<void(juce::Component *)> rec;
+    rec = [&rec, this](juce::Component *c) {
+        if (c->getWantsKeyboardFocus())
+        {
+            c->addKeyListener(this);
+            keyTargets.emplace_back(c);
+        }
+        for (auto *ch : c->getChildren())
+            rec(ch);
+    };
+    rec(&root);
+}
+
+void GestureRecorder::stop()
+{
+    if (!recording)
+        return;
+    recording = false;
+    root.removeMouseListener(this);
+    for (auto &k : keyTargets)
+        if (k)
+            k->removeKeyListener(this);
+    keyTargets.clear();
+}
+
+std::vector<int> GestureRecorder::pathTo(juce::Component *c) const
+{
+    std::vector<int> res;
+    while (c && c != &root)
+    {
+        auto p = c->getParentComponent();
+        if (!p)
+            break;
+        res.push_back(p->getIndexOfChildComponent(c));
+        c = p;
+    }
+    std::reverse(res.begin(), res.end());
+    return res;
+}
+
+Gesture *GestureRecorder::add(Gesture::Kind k, const juce::MouseEvent &e)
+{
+    if (!recording)
+        return nullptr;
+    Gesture g;
+    g.kind = k;
+    g.timeMs = juce::Time::getMillisecondCounterHiRes() - startMs;
+    g.path = pathTo(e.eventComponent);
+    g.x = e.position.x;
+    g.y = e.position.y;
+    g.mods = e.mods.getRawFlags();
+    g.clicks = e.getNumberOfClicks();
+    result.gestures.push_back(std::move(g));
+    return &result.gestures.back();
+}
+
+void GestureRecorder::mouseWheelMove(const juce::MouseEvent &e, const juce::MouseWheelDetails &w)
+{
+    if (auto g = add(Gesture::WHEEL, e))
+    {
+        g->wheelDeltaX = w.deltaX;
+        g->wheelDeltaY = w.deltaY;
+        g->wheelReversed = w.isReversed;
+        g->wheelSmooth = w.isSmooth;
+    }
+}
+
+bool GestureRecorder::keyPressed(const juce::KeyPress &key, juce::Component *origin)
+{
+    if (!recording || !isDeepestKeyTarget(origin))
+        return false;
+    Gesture g;
+    g.kind = Gesture::KEY;
+    g.timeMs = juce::Time::getMillisecondCounterHiRes() - startMs;
+    g.path = pathTo(origin);
+    g.mods = key.getModifiers().getRawFlags();
+    g.keyCode = key.getKeyCode();
+    g.keyChar = (uint32_t)key.getTextCharacter();
+    result.gestures.push_back(std::move(g));
+    return false;
+}
+
+bool GestureRecorder::isDeepestKeyTarget(juce::Component *origin) const
+{
+    // JUCE offers a key to the focused component and then to each parent, calling the
+    // listeners of every one, so the first listened to component up from focus records it
+    for (auto *c = juce::Component::getCurrentlyFocusedComponent(); c; c = c->getParentComponent())
+    {
+        auto listened = std::any_of(keyTargets.begin(), keyTargets.end(),
+                                    [c](const auto &k) { return k.getComponent() == c; });
+        if (listened)
+            return c == origin;
+        if (c == &root)
+            break;
+    }
+    return true;
+}
+
+juce::Component *GestureReplayer::resolve(const std::vector<int> &path) const
+{
+    auto *c = &root;
+    for (auto idx : path)
+    {
+        if (idx < 0 || idx >= c->getNumChildComponents())
+            return nullptr;
+        c = c->getChildComponent(idx);
+    }
+    return c;
+}
+
+bool GestureReplayer::dispatch(const Gesture &g)
+{
+    auto *c = resolve(g.path);
+    if (!c)
+        return false;
+
+    auto mods = juce::ModifierKeys(g.mods);
+    if (g.kind == Gesture::KEY)
+    {
+        auto kp = juce::KeyPress(g.keyCode, mods, (juce::juce_wchar)g.keyChar);
+        for (auto *k = c; k; k = k->getParentComponent())
+        {
+            if (k->keyPressed(kp) || k == &root)
+                break;
+        }
+        return true;
+    }
+
+    auto pos = juce::Point<float>(g.x, g.y);
+    auto t = juce::Time(baseTime.toMilliseconds() + (juce::int64)g.timeMs);
+    if (g.kind == Gesture::DOWN)
+    {
+        downPosition = pos;
+        downTime = t;
+        dragged = false;
+    }
+    else if (g.kind == Gesture::DRAG)
+    {
+        dragged = true;
+    }
+
+    using src = juce::MouseInputSource;
+    auto e = juce::MouseEvent(juce::Desktop::getInstance().getMainMouseSource(), pos, mods,
+                              src::defaultPressure, src::defaultOrientation, src::defaultRotation,
+                              src::defaultTiltX, src::defaultTiltY, c, c, t, downPosition,
+                              downTime, g.clicks, dragged);
+    switch (g.kind)
+    {
+    case Gesture::DOWN:
+        c->mouseDown(e);
+        break;
+    case Gesture::DRAG:
+        c->mouseDrag(e);
+        break;
+    case Gesture::UP:
+        c->mouseUp(e);
+        break;
+    case Gesture::MOVE:
+        c->mouseMove(e);
+        break;
+    case Gesture::ENTER:
+        c->mouseEnter(e);
+        break;
+    case Gesture::EXIT:
+        c->mouseExit(e);
+        break;
+    case Gesture::DOUBLE_CLICK:
+        c->mouseDoubleClick(e);
+        break;
+    case Gesture::WHEEL:
+    {
+        juce::MouseWheelDetails w;
+        w.deltaX = g.wheelDeltaX;
+        w.deltaY = g.wheelDeltaY;
+        w.isReversed = g.wheelReversed;
+        w.isSmooth = g.wheelSmooth;
+        w.isInertial = false;
+        c->mouseWheelMove(e, w);
+        break;
+    }
+    case Gesture::KEY:
+        break;
+    }
+    return true;
+}
+
+GestureReplayer::Stats GestureReplayer::replay(const GestureRecording &r)
+{
+    using clock = std::chrono::steady_clock;
+    Stats res;
+    baseTime = juce::Time::getCurrentTime();
+    downTime = baseTime;
+    dragged = false;
+
+    auto start = clock::now();
+    for (const auto &g : r.gestures)
+    {
+        auto t0 = clock::now();
+        if (!dispatch(g))
+        {
+            res.skipped++;
+            continue;
+        }
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - t0).count();
+        res.events++;
+        res.allNs.record((uint64_t)ns);
+        if (g.kind == Gesture::DRAG)
+            res.dragNs.record((uint64_t)ns);
+    }
+    res.wallMs = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    return res;
+}
+
+std::string GestureReplayer::Stats::getReport() const
+{
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1);
+    oss << "events " << events << " (" << skipped << " skipped) in " << wallMs << "ms, "
+        << eventsPerSecond() << " events/s\n";
+    auto line = [&oss](const char *name, const auto &h) {
+        oss << name << " ns: mean " << h.mean() << " p50 " << h.valueAtPercentile(50) << " p99 "
+            << h.valueAtPercentile(99) << " max " << h.max() << "\n";
+    };
+    line("handler", allNs);
+    line("drag", dragNs);
+    return oss.str();
+}
+} // namespace sst::jucegui::components
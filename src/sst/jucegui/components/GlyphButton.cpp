@@ -30,6 +30,7 @@ GlyphButton::~GlyphButton() {}
 
 void GlyphButton::paint(juce::Graphics &g)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("paint");
     float rectCorner = 1.5;
 
     auto b = getLocalBounds().reduced(1).toFloat();
@@ -65,4 +66,11 @@ void GlyphButton::paint(juce::Graphics &g)
     g.setColour(getColour(Styles::bordercol));
     g.drawRoundedRectangle(b, rectCorner, 1);
 }
+
+void GlyphButton::describeFootprint(util::Footprint &f) const
+{
+    StyleConsumer::describeFootprint(f);
+    describeEditableFootprint(f);
+    describeCallbackFootprint(f);
+}
 } // namespace sst::jucegui::components
\ No newline at end of file
@@ -172,6 +172,7 @@ static void paintBigPlusGlyph(juce::Graphics &g, const juce::Rectangle<int> &int
 }
 void GlyphPainter::paint(juce::Graphics &g)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("paint");
     g.setColour(getColour(Styles::controlLabelCol));
     paintGlyph(g, getLocalBounds(), glyph);
 };
@@ -226,5 +227,4 @@ void GlyphPainter::paintGlyph(juce::Graphics &g, const juce::Rectangle<int> &int
     }
     g.fillRect(into);
 }
-
 } // namespace sst::jucegui::components
\ No newline at end of file
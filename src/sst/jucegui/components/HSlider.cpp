@@ -28,6 +28,7 @@ HSlider::~HSlider() = default;
 
 void HSlider::paint(juce::Graphics &g)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("paint");
     if (!source)
     {
         g.fillAll(juce::Colours::red);
@@ -93,14 +94,14 @@ void HSlider::paint(juce::Graphics &g)
         g.fillRoundedRectangle(gutter.reduced(2), gutterheight * 0.25);
     }
 
-    auto v = source->getValue01();
+    auto v = getDisplayValue01();
     auto w = (1 - v) * gutter.getWidth();
     auto hc = gutter.withTrimmedLeft(gutter.getWidth() - w).withWidth(1).expanded(0, 4).getCentre();
 
     if (source->isBipolar())
     {
         auto t = hc.getX();
-        auto b = gutter.getWidth() / 2 + gutter.getX();
+        auto b = source->valueTo01(0.f) * gutter.getWidth() + gutter.getX();
         if (t > b)
             std::swap(t, b);
         auto val = gutter.withLeft(t).withRight(b);
@@ -148,6 +149,10 @@ void HSlider::paint(juce::Graphics &g)
         }
     }
 
+    paintLiveModulation(g, getColour(Styles::modhandlecol), 2.f, [gutter](float lv) {
+        return juce::Point<float>(gutter.getX() + lv * gutter.getWidth(), gutter.getCentreY());
+    });
+
     if (isHovered)
         g.setColour(getColour(Styles::handlehovcol));
     else
@@ -163,4 +168,9 @@ void HSlider::paint(juce::Graphics &g)
     }
 }
 
+void HSlider::describeFootprint(util::Footprint &f) const
+{
+    StyleConsumer::describeFootprint(f);
+    describeEditorFootprint(f);
+}
 } // namespace sst::jucegui::components
\ No newline at end of file
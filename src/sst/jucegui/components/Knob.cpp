@@ -26,6 +26,7 @@ Knob::~Knob() = default;
 
 void Knob::paint(juce::Graphics &g)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("paint");
     if (!source)
     {
         g.fillAll(juce::Colours::red);
@@ -67,7 +68,7 @@ void Knob::paint(juce::Graphics &g)
             auto v0 = v;
             v = 2 * v - 1;
             // split between dAng and -dAnd
-            float zero01 = (0-source->getMin())/(source->getMax()-source->getMin());
+            float zero01 = source->valueTo01(0.f);
             // 1 -> dAng; 0 -> -dAng again so
             start = dAng * ( 2 * zero01 - 1);
             end = dAng * v;
@@ -123,24 +124,25 @@ void Knob::paint(juce::Graphics &g)
     g.setColour(getColour(Styles::backgroundcol));
     g.fillPath(pIn);
 
-    pIn = pathWithReduction(3, source->getValue01());
+    auto v01 = getDisplayValue01();
+    pIn = pathWithReduction(3, v01);
     g.setColour(getColour(Styles::valcol));
     g.fillPath(pIn);
 
     if (isEditingMod)
     {
-        pIn = modPath(5, source->getValue01(), source->getModulationValuePM1(), 1);
+        pIn = modPath(5, v01, source->getModulationValuePM1(), 1);
         g.setColour(getColour(Styles::modvalcol));
         g.fillPath(pIn);
         if (source->isModulationBipolar())
         {
-            pIn = modPath(5, source->getValue01(), source->getModulationValuePM1(), -1);
+            pIn = modPath(5, v01, source->getModulationValuePM1(), -1);
             g.setColour(getColour(Styles::modvalnegcol));
             g.fillPath(pIn);
         }
     }
 
-    pIn = handlePath(3, source->getValue01());
+    pIn = handlePath(3, v01);
     if (isHovered)
     {
         g.setColour(getColour(Styles::handlecol));
@@ -153,7 +155,7 @@ void Knob::paint(juce::Graphics &g)
 
     if (isHovered)
     {
-        auto pGrad = pathWithReduction(8, source->getValue01());
+        auto pGrad = pathWithReduction(8, v01);
         auto cg = juce::ColourGradient(getColour(Styles::gradientcenter), knobarea.getCentreX(),
                                        knobarea.getCentreY(), getColour(Styles::backgroundcol),
                                        knobarea.getCentreX(), knobarea.getY() - 3, true);
@@ -164,6 +166,14 @@ void Knob::paint(juce::Graphics &g)
     {
     }
 
+    paintLiveModulation(g, getColour(Styles::modhandlecol), 2.f, [knobarea](float lv) {
+        float dAng = juce::MathConstants<float>::pi * (1 - 0.2);
+        auto a = dAng * (2 * lv - 1);
+        auto r = knobarea.getWidth() * 0.5f - 5.5f;
+        auto c = knobarea.toFloat().getCentre();
+        return juce::Point<float>(c.x + r * std::sin(a), c.y - r * std::cos(a));
+    });
+
     if (modulationDisplay == FROM_ACTIVE)
     {
         pOut = circle(8);
@@ -186,4 +196,9 @@ void Knob::paint(juce::Graphics &g)
     g.drawText(source->getLabel(), textarea, juce::Justification::centred);
 }
 
+void Knob::describeFootprint(util::Footprint &f) const
+{
+    StyleConsumer::describeFootprint(f);
+    describeEditorFootprint(f);
+}
 } // namespace sst::jucegui::components
\ No newline at end of file
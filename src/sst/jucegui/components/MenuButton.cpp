@@ -25,6 +25,7 @@ MenuButton::~MenuButton() {}
 
 void MenuButton::paint(juce::Graphics &g)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("paint");
     float rectCorner = 1.5;
 
     auto b = getLocalBounds().reduced(1).toFloat();
@@ -78,4 +79,11 @@ void MenuButton::paint(juce::Graphics &g)
     g.setColour(getColour(Styles::bordercol));
     g.drawRoundedRectangle(b, rectCorner, 1);
 }
+
+void MenuButton::describeFootprint(util::Footprint &f) const
+{
+    StyleConsumer::describeFootprint(f);
+    describeEditableFootprint(f);
+    describeCallbackFootprint(f);
+}
 } // namespace sst::jucegui::components
\ No newline at end of file
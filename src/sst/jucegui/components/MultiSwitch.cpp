@@ -30,6 +30,7 @@ MultiSwitch::~MultiSwitch()
 
 void MultiSwitch::paint(juce::Graphics &g)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("paint");
     if (!data || data->getMin() == data->getMax())
     {
         g.fillAll(juce::Colours::red);
@@ -147,10 +148,11 @@ void MultiSwitch::setValueFromMouse(const juce::MouseEvent &e)
         val = (int)(e.x / h);
     }
     if (val != data->getValue())
-        data->setValueFromGUI(val);
+        setValueFromGUIJournaled(data, val);
 }
 void MultiSwitch::mouseDown(const juce::MouseEvent &e)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseDown");
     if (data && data->isHidden())
         return;
 
@@ -162,16 +164,17 @@ void MultiSwitch::mouseDown(const juce::MouseEvent &e)
         return;
     }
 
-    onBeginEdit();
+    beginEdit();
     setValueFromMouse(e);
 }
 
 void MultiSwitch::mouseUp(const juce::MouseEvent &e)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseUp");
     if (data && data->isHidden())
         return;
     if (!didPopup)
-        onEndEdit();
+        endEdit();
     repaint();
 }
 
@@ -179,6 +182,7 @@ void MultiSwitch::dataChanged() { repaint(); }
 
 void MultiSwitch::mouseMove(const juce::MouseEvent &e)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseMove");
     if (data && data->isHidden())
         return;
     hoverY = e.y;
@@ -187,6 +191,7 @@ void MultiSwitch::mouseMove(const juce::MouseEvent &e)
 }
 void MultiSwitch::mouseDrag(const juce::MouseEvent &e)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseDrag");
     if (data && data->isHidden())
         return;
     hoverY = e.y;
@@ -197,4 +202,9 @@ void MultiSwitch::mouseDrag(const juce::MouseEvent &e)
     repaint();
 }
 
+void MultiSwitch::describeFootprint(util::Footprint &f) const
+{
+    StyleConsumer::describeFootprint(f);
+    describeEditableFootprint(f);
+}
 } // namespace sst::jucegui::components
\ No newline at end of file
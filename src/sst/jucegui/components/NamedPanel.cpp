@@ -29,6 +29,7 @@ NamedPanel::~NamedPanel() {}
 
 void NamedPanel::paint(juce::Graphics &g)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("paint");
     if (!style())
     {
         g.fillAll(juce::Colours::red);
@@ -115,6 +116,7 @@ juce::Rectangle<int> NamedPanel::getContentArea()
 
 void NamedPanel::resized()
 {
+    SST_JUCEGUI_PROFILE_SCOPE("resized");
     if (contentAreaComp)
     {
         auto c = getContentArea();
@@ -137,6 +139,7 @@ juce::Rectangle<int> NamedPanel::getHamburgerRegion()
 }
 void NamedPanel::mouseDown(const juce::MouseEvent &event)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseDown");
     if (hasHamburger && onHamburger && getHamburgerRegion().toFloat().contains(event.position))
     {
         onHamburger();
@@ -162,15 +165,30 @@ void NamedPanel::mouseDown(const juce::MouseEvent &event)
 void NamedPanel::resetTabState()
 {
     auto f = getFont(Styles::regionLabelFont);
+    if (!(f == measuredFont))
+    {
+        measuredFont = f;
+        measuredTabNames.clear();
+        measuredTabWidths.clear();
+    }
+    measuredTabNames.resize(tabNames.size());
+    measuredTabWidths.resize(tabNames.size(), -1);
+    for (size_t i = 0; i < tabNames.size(); ++i)
+    {
+        if (measuredTabWidths[i] < 0 || measuredTabNames[i] != tabNames[i])
+        {
+            measuredTabNames[i] = tabNames[i];
+            measuredTabWidths[i] = f.getStringWidth("[ " + tabNames[i] + " ]");
+        }
+    }
 
     auto b = getLocalBounds().reduced(outerMargin);
     auto ht = b.withHeight(headerHeight).reduced(4, 0); // the extra margin
 
     int totalTabSize = 4;
     tabPositions.clear();
-    for (const auto &t : tabNames)
+    for (auto fw : measuredTabWidths)
     {
-        auto fw = f.getStringWidth("[ " + t + " ]");
         auto tt = ht.withLeft(totalTabSize + 4).withWidth(fw);
         tabPositions.push_back(tt);
         totalTabSize += fw;
@@ -178,4 +196,16 @@ void NamedPanel::resetTabState()
 
     totalTabArea = ht.withWidth(totalTabSize);
 }
+
+void NamedPanel::describeFootprint(util::Footprint &f) const
+{
+    StyleConsumer::describeFootprint(f);
+    f.addInline("onTabSelected", sizeof(onTabSelected));
+    f.addInline("onHamburger", sizeof(onHamburger));
+    f.addHeap("name", util::heapBytesOf(name));
+    f.addHeap("tabNames", util::heapBytesOf(tabNames));
+    f.addHeap("tabPositions", util::heapBytesOf(tabPositions));
+    f.addHeap("measuredTabNames", util::heapBytesOf(measuredTabNames));
+    f.addHeap("measuredTabWidths", util::heapBytesOf(measuredTabWidths));
+}
 } // namespace sst::jucegui::components
\ No newline at end of file
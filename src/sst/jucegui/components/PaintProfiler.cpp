@@ -0,0 +1,154 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#include <sst/jucegui/components/PaintProfiler.h>
+
+#if SST_JUCEGUI_PROFILE
+#include <sst/jucegui/components/FrameStats.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace sst::jucegui::components
+{
+namespace
+{
+/*
+ * Rings are never freed, so a dump can read one whose thread has gone. A thread gives its
+ * ring back when it exits and the next new thread takes it over, so threads which come
+ * and go do not grow the list.
+ */
+struct Ring
+{
+    PaintProfiler::Event events[PaintProfiler::eventsPerThread];
+    std::atomic<uint64_t> written{0}, clearedAt{0};
+    std::atomic<bool> inUse{true};
+    uint32_t index{0};
+    Ring *next{nullptr};
+};
+std::atomic<Ring *> rings{nullptr};
+std::atomic<uint32_t> ringCount{0};
+
+Ring *claimRing()
+{
+    for (auto *r = rings.load(std::memory_order_acquire); r; r = r->next)
+    {
+        auto idle = false;
+        if (r->inUse.compare_exchange_strong(idle, true))
+            return r;
+    }
+    auto r = new Ring();
+    r->index = ringCount.fetch_add(1);
+    r->next = rings.load(std::memory_order_relaxed);
+    while (!rings.compare_exchange_weak(r->next, r, std::memory_order_release,
+                                        std::memory_order_relaxed))
+        ;
+    return r;
+}
+
+struct ThreadRing
+{
+    Ring *ring{claimRing()};
+    ~ThreadRing() { ring->inUse = false; }
+};
+
+Ring &ringForThisThread()
+{
+    thread_local ThreadRing tr;
+    return *tr.ring;
+}
+
+void writeJsonString(std::ostream &os, const char *s)
+{
+    os << '"';
+    for (; *s; ++s)
+    {
+        if (*s == '"' || *s == '\\')
+            os << '\\' << *s;
+        else if ((unsigned char)*s >= ' ')
+            os << *s;
+    }
+    os << '"';
+}
+} // namespace
+
+int64_t PaintProfiler::nowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void PaintProfiler::record(const char *styleClass, const char *what, int64_t startUs,
+                           int64_t endUs)
+{
+    auto &r = ringForThisThread();
+    auto w = r.written.load(std::memory_order_relaxed);
+    auto &e = r.events[w % eventsPerThread];
+    e.what = what;
+    std::strncpy(e.styleClass, styleClass, classNameLength - 1);
+    e.styleClass[classNameLength - 1] = 0;
+    e.startUs = startUs;
+    e.durationUs = endUs - startUs;
+    r.written.store(w + 1, std::memory_order_release);
+
+    auto fs = FrameStats::getActive();
+    if (fs && std::strcmp(what, "paint") == 0)
+        fs->notePaint(styleClass, endUs - startUs);
+}
+
+void PaintProfiler::clear()
+{
+    for (auto *r = rings.load(std::memory_order_acquire); r; r = r->next)
+        r->clearedAt.store(r->written.load(std::memory_order_acquire));
+}
+
+void PaintProfiler::writeChromeTrace(std::ostream &os)
+{
+    os << "{\"traceEvents\":[";
+    auto first = true;
+    std::vector<Event> copy;
+    for (auto *r = rings.load(std::memory_order_acquire); r; r = r->next)
+    {
+        auto end = r->written.load(std::memory_order_acquire);
+        auto begin = std::max(r->clearedAt.load(),
+                              end > eventsPerThread ? end - eventsPerThread : uint64_t(0));
+        copy.clear();
+        for (auto i = begin; i < end; ++i)
+            copy.push_back(r->events[i % eventsPerThread]);
+
+        // The owner may have lapped the slots we copied from while we read them
+        auto after = r->written.load(std::memory_order_acquire);
+        auto valid = after >= eventsPerThread ? after - eventsPerThread + 1 : uint64_t(0);
+        for (auto i = std::max(begin, valid); i < end; ++i)
+        {
+            const auto &e = copy[i - begin];
+            os << (first ? "\n" : ",\n") << "{\"name\":";
+            first = false;
+            writeJsonString(os, (std::string(e.styleClass) + "::" + e.what).c_str());
+            os << ",\"cat\":";
+            writeJsonString(os, e.styleClass);
+            os << ",\"ph\":\"X\",\"ts\":" << e.startUs << ",\"dur\":" << e.durationUs
+               << ",\"pid\":1,\"tid\":" << r->index << "}";
+        }
+    }
+    os << "\n]}\n";
+}
+} // namespace sst::jucegui::components
+#endif
@@ -20,30 +20,115 @@
 namespace sst::jucegui::components
 {
 
-TabularizedTreeViewer::TabularizedTreeViewer() : style::StyleConsumer(Styles::styleClass) {}
+TabularizedTreeViewer::TabularizedTreeViewer() : style::StyleConsumer(Styles::styleClass)
+{
+    setWantsKeyboardFocus(true);
+}
+TabularizedTreeViewer::~TabularizedTreeViewer()
+{
+    FrameScheduler::cancelFrames(this);
+    if (data)
+        data->removeListener(this);
+}
+
+void TabularizedTreeViewer::setSource(data::TabularizedTreeView *d)
+{
+    if (data)
+        data->removeListener(this);
+    data = d;
+    columnWidths.clear();
+    if (data)
+    {
+        data->addListener(this);
+        for (uint32_t c = 1; c < data->getColumnCount(); ++c)
+            columnWidths.push_back(data->getColumnInfo(c).defaultWidth);
+        if (data->isExpanding())
+            FrameScheduler::getInstance().requestFrames(this);
+    }
+    hoveredOpenCloseZone = -1;
+    selectedRow = -1;
+    typeAhead.clear();
+    sizeToViewport();
+    repaint();
+}
+
+void TabularizedTreeViewer::sizeToViewport()
+{
+    auto vp = findParentComponentOfClass<juce::Viewport>();
+    if (!vp || vp->getViewedComponent() != this)
+        return;
+    setSize(vp->getMaximumVisibleWidth(),
+            std::max(getContentHeight(), vp->getMaximumVisibleHeight()));
+}
+
+juce::Rectangle<int> TabularizedTreeViewer::getColumnBounds(uint32_t col,
+                                                           const juce::Rectangle<int> &area) const
+{
+    auto res = area;
+    for (auto c = (uint32_t)columnWidths.size(); c >= 1; --c)
+    {
+        auto slice = res.removeFromRight(std::min(columnWidths[c - 1], res.getWidth()));
+        if (c == col)
+            return slice;
+    }
+    return res;
+}
+
+void TabularizedTreeViewer::setColumnWidth(uint32_t col, int w)
+{
+    if (col == 0 || col > columnWidths.size())
+        return;
+    columnWidths[col - 1] = w;
+    repaint();
+}
+
 void TabularizedTreeViewer::paint(juce::Graphics &g)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("paint");
     if (!data)
         return;
 
-    auto dr = getLocalBounds().withHeight(rowHeight);
-    for (uint32_t i = 0; i < data->getRowCount(); ++i)
+    // Only rows which intersect the clip region; in a viewport that is the visible few
+    auto clip = g.getClipBounds();
+    auto rowCount = data->getRowCount();
+    auto firstRow = (uint32_t)std::clamp(clip.getY() / rowHeight, 0, (int)rowCount);
+    auto endRow =
+        (uint32_t)std::clamp((clip.getBottom() + rowHeight - 1) / rowHeight, 0, (int)rowCount);
+
+    auto dr = getLocalBounds().withHeight(rowHeight).translated(0, firstRow * rowHeight);
+    for (uint32_t i = firstRow; i < endRow; ++i)
     {
         const auto &row = data->getRow(i);
-        auto qr = dr;
+        if ((int)i == selectedRow)
+        {
+            g.setColour(getColour(Styles::selectedrowcol));
+            g.fillRect(dr);
+        }
+
+        auto qr = getColumnBounds(0, dr);
         qr = qr.withTrimmedLeft(row.depth * rowIndent);
 
         g.setColour(juce::Colours::black);
         qr = qr.withTrimmedLeft(hotzoneSize + 4);
         g.setFont(getFont(Styles::controlLabelFont));
         g.setColour(getColour(Styles::controlLabelCol));
-        g.drawText(row.label, qr, juce::Justification::centredLeft);
+        g.drawText(row.getLabel(), qr, juce::Justification::centredLeft);
+
+        if (row.type != data::TabularizedTreeView::TabularizedRow::PLACEHOLDER)
+        {
+            for (uint32_t c = 1; c <= columnWidths.size(); ++c)
+            {
+                auto v = row.entry->getDataForColumn(c);
+                auto just = v.type == data::ColumnValue::STRING ? juce::Justification::centredLeft
+                                                                : juce::Justification::centredRight;
+                g.drawText(v.toDisplayString(), getColumnBounds(c, dr).reduced(4, 0), just);
+            }
+        }
 
         g.setColour(getColour(Styles::connectorcol));
         if (row.depth > 0)
         {
-            uint32_t subsequentDepth =
-                (i == data->getRowCount() - 1 ? 0 : data->getRow(i + 1).depth);
+            uint32_t subsequentDepth = (i == rowCount - 1 ? 0 : data->getRow(i + 1).depth);
             auto rr = dr.withTrimmedLeft((row.depth - 1) * rowIndent).withWidth(rowIndent);
             if (subsequentDepth == row.depth)
             {
@@ -68,10 +153,11 @@ void TabularizedTreeViewer::paint(juce::Graphics &g)
         }
 
         g.setColour(juce::Colours::black);
-        if (rowDisplayCache[i].type != data::TabularizedTreeView::TabularizedRow::NODE)
+        if (row.isExpandable())
         {
+            auto zone = openCloseZoneFor(i);
             g.setColour(getColour(Styles::toggleboxcol));
-            g.drawRect(rowDisplayCache[i].openCloseZone);
+            g.drawRect(zone);
 
             if (i == hoveredOpenCloseZone)
             {
@@ -81,10 +167,10 @@ void TabularizedTreeViewer::paint(juce::Graphics &g)
             {
                 g.setColour(getColour(Styles::toggleglyphcol));
             }
-            if (rowDisplayCache[i].type == data::TabularizedTreeView::TabularizedRow::OPEN)
+            if (row.type == data::TabularizedTreeView::TabularizedRow::OPEN)
             {
                 // I am open so draw a minus
-                auto q = rowDisplayCache[i].openCloseZone;
+                auto q = zone;
                 q = q.withTrimmedTop(q.getHeight() / 2 - 1)
                         .withTrimmedLeft(4)
                         .withTrimmedRight(4)
@@ -93,13 +179,13 @@ void TabularizedTreeViewer::paint(juce::Graphics &g)
             }
             else
             {
-                auto q = rowDisplayCache[i].openCloseZone;
+                auto q = zone;
                 q = q.withTrimmedTop(q.getHeight() / 2 - 1)
                         .withTrimmedLeft(4)
                         .withTrimmedRight(4)
                         .withHeight(2);
                 g.fillRect(q);
-                q = rowDisplayCache[i].openCloseZone;
+                q = zone;
                 q = q.withTrimmedLeft(q.getWidth() / 2 - 1)
                         .withTrimmedTop(4)
                         .withTrimmedBottom(4)
@@ -120,65 +206,303 @@ void TabularizedTreeViewer::paint(juce::Graphics &g)
     }
 }
 
-void TabularizedTreeViewer::recalcRowDisplayCache()
+juce::Rectangle<int> TabularizedTreeViewer::openCloseZoneFor(uint32_t i) const
 {
-    rowDisplayCache.clear();
-    auto bhz = juce::Rectangle<int>().withHeight(hotzoneSize).withWidth(hotzoneSize);
-    for (uint32_t i = 0; i < data->getRowCount(); ++i)
-    {
-        const auto &row = data->getRow(i);
-        auto rr = bhz.translated(row.depth * rowIndent + 2,
-                                 i * rowHeight + (rowHeight - hotzoneSize) / 2);
-        auto newRow = RowDisplayData{rr, row.type, i};
-        rowDisplayCache.push_back(newRow);
-    }
+    const auto &row = data->getRow(i);
+    return juce::Rectangle<int>(row.depth * rowIndent + 2,
+                                i * rowHeight + (rowHeight - hotzoneSize) / 2, hotzoneSize,
+                                hotzoneSize);
+}
+
+void TabularizedTreeViewer::repaintFromRow(uint32_t row)
+{
+    // Rows above the change do not move. Painting is clipped, so this stays cheap in a
+    // viewport however long the tree is.
+    auto y = (int)row * rowHeight;
+    repaint(0, y, getWidth(), std::max(0, getHeight() - y));
+}
+
+void TabularizedTreeViewer::repaintRow(int row)
+{
+    if (row >= 0)
+        repaint(0, row * rowHeight, getWidth(), rowHeight);
+}
+
+void TabularizedTreeViewer::rowsInserted(uint32_t at, uint32_t count)
+{
+    if (hoveredOpenCloseZone >= (int)at)
+        hoveredOpenCloseZone += count;
+    if (selectedRow >= (int)at)
+        selectedRow += count;
+    sizeToViewport();
+    repaintFromRow(at);
+}
+
+void TabularizedTreeViewer::rowsRemoved(uint32_t at, uint32_t count)
+{
+    if (hoveredOpenCloseZone >= (int)(at + count))
+        hoveredOpenCloseZone -= count;
+    else if (hoveredOpenCloseZone >= (int)at)
+        hoveredOpenCloseZone = -1;
+
+    // A selection which goes away moves to the row above, which closing leaves selected
+    if (selectedRow >= (int)(at + count))
+        selectedRow -= count;
+    else if (selectedRow >= (int)at)
+        selectedRow = std::min((int)at - 1, (int)data->getRowCount() - 1);
+    sizeToViewport();
+    repaintFromRow(at);
 }
 
+void TabularizedTreeViewer::rowChanged(uint32_t row) { repaintRow(row); }
+
 void TabularizedTreeViewer::rowClick(uint32_t row) {}
 
+int TabularizedTreeViewer::rowAt(const juce::Point<float> &p) const
+{
+    if (p.y < 0)
+        return -1;
+    auto r = (uint32_t)(p.y / rowHeight);
+    if (!data || r >= data->getRowCount())
+        return -1;
+    return (int)r;
+}
+
 void TabularizedTreeViewer::mouseMove(const juce::MouseEvent &e)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseMove");
     int ohz = hoveredOpenCloseZone;
     hoveredOpenCloseZone = -1;
-    for (const auto &z : rowDisplayCache)
+    auto r = rowAt(e.position);
+    if (r >= 0 && data->getRow(r).isExpandable() &&
+        openCloseZoneFor(r).toFloat().contains(e.position))
     {
-        if (z.openCloseZone.toFloat().contains(e.position))
-        {
-            hoveredOpenCloseZone = z.row;
-        }
+        hoveredOpenCloseZone = r;
     }
 
     if (hoveredOpenCloseZone != ohz)
-        repaint();
+    {
+        // only the rows whose glyph changed
+        repaintRow(ohz);
+        repaintRow(hoveredOpenCloseZone);
+    }
+}
+
+void TabularizedTreeViewer::mouseDown(const juce::MouseEvent &e)
+{
+    SST_JUCEGUI_PROFILE_SCOPE("mouseDown");
+    grabKeyboardFocus();
+    auto r = rowAt(e.position);
+    if (r >= 0)
+        setSelectedRow(r);
 }
 
 void TabularizedTreeViewer::mouseUp(const juce::MouseEvent &e)
 {
-    bool doRecalc = false;
-    for (const auto &z : rowDisplayCache)
+    SST_JUCEGUI_PROFILE_SCOPE("mouseUp");
+    auto r = rowAt(e.position);
+    if (r < 0)
+        return;
+
+    const auto &row = data->getRow(r);
+    if (!row.isExpandable() || !openCloseZoneFor(r).toFloat().contains(e.position))
+        return;
+
+    // the view reports the resulting row changes back to us as a listener
+    if (row.type == data::TabularizedTreeView::TabularizedRow::OPEN)
     {
-        if (z.type != data::TabularizedTreeView::TabularizedRow::NODE)
+        if (e.mods.isAltDown())
+            data->collapseSubtree(r);
+        else
+            data->close(r);
+    }
+    else
+    {
+        if (e.mods.isAltDown())
+            expandSubtree(r);
+        else
+            data->open(r);
+    }
+}
+
+void TabularizedTreeViewer::expandSubtree(uint32_t row, int maxDepth)
+{
+    if (!data || row >= data->getRowCount())
+        return;
+    data->expandSubtree(row, maxDepth);
+    if (data->isExpanding())
+        FrameScheduler::getInstance().requestFrames(this);
+}
+
+void TabularizedTreeViewer::setSelectedRow(int row)
+{
+    if (!data || row >= (int)data->getRowCount())
+        row = -1;
+    if (row == selectedRow)
+        return;
+    repaintRow(selectedRow);
+    selectedRow = row;
+    repaintRow(selectedRow);
+    scrollToRow(selectedRow);
+}
+
+void TabularizedTreeViewer::scrollToRow(int row)
+{
+    auto vp = findParentComponentOfClass<juce::Viewport>();
+    if (!vp || row < 0)
+        return;
+    auto top = row * rowHeight;
+    auto y = vp->getViewPositionY();
+    if (top < y)
+        vp->setViewPosition(vp->getViewPositionX(), top);
+    else if (top + rowHeight > y + vp->getViewHeight())
+        vp->setViewPosition(vp->getViewPositionX(), top + rowHeight - vp->getViewHeight());
+}
+
+int TabularizedTreeViewer::rowsPerPage() const
+{
+    auto h = getHeight();
+    if (auto vp = findParentComponentOfClass<juce::Viewport>())
+        h = vp->getViewHeight();
+    return std::max(1, h / rowHeight - 1);
+}
+
+bool TabularizedTreeViewer::keyPressed(const juce::KeyPress &key)
+{
+    if (!data || data->getRowCount() == 0)
+        return false;
+
+    using row_t = data::TabularizedTreeView::TabularizedRow;
+    auto n = (int)data->getRowCount();
+    auto sel = std::clamp(selectedRow, 0, n - 1);
+    auto alt = key.getModifiers().isAltDown();
+
+    if (key.isKeyCode(juce::KeyPress::upKey))
+        setSelectedRow(selectedRow < 0 ? 0 : std::max(sel - 1, 0));
+    else if (key.isKeyCode(juce::KeyPress::downKey))
+        setSelectedRow(selectedRow < 0 ? 0 : std::min(sel + 1, n - 1));
+    else if (key.isKeyCode(juce::KeyPress::pageUpKey))
+        setSelectedRow(std::max(sel - rowsPerPage(), 0));
+    else if (key.isKeyCode(juce::KeyPress::pageDownKey))
+        setSelectedRow(std::min(sel + rowsPerPage(), n - 1));
+    else if (key.isKeyCode(juce::KeyPress::homeKey))
+        setSelectedRow(0);
+    else if (key.isKeyCode(juce::KeyPress::endKey))
+        setSelectedRow(n - 1);
+    else if (key.isKeyCode(juce::KeyPress::rightKey))
+    {
+        const auto &row = data->getRow(sel);
+        if (alt && row.isExpandable())
+            expandSubtree(sel);
+        else if (row.type == row_t::CLOSED)
+            data->open(sel);
+        else if (row.type == row_t::OPEN && sel + 1 < n)
+            setSelectedRow(sel + 1);
+        else
+            setSelectedRow(sel);
+    }
+    else if (key.isKeyCode(juce::KeyPress::leftKey))
+    {
+        const auto &row = data->getRow(sel);
+        if (row.type == row_t::OPEN)
         {
-            if (z.openCloseZone.toFloat().contains(e.position))
-            {
-                if (z.type == data::TabularizedTreeView::TabularizedRow::OPEN)
-                {
-                    data->close(z.row);
-                }
-                else
-                {
-                    data->open(z.row);
-                }
-                doRecalc = true;
-                break;
-            }
+            if (alt)
+                data->collapseSubtree(sel);
+            else
+                data->close(sel);
+            setSelectedRow(sel);
         }
+        else
+        {
+            // the parent is the nearest shallower row above
+            auto p = sel;
+            while (p > 0 && data->getRow(p).depth >= row.depth)
+                p--;
+            setSelectedRow(p);
+        }
+    }
+    else
+    {
+        auto c = key.getTextCharacter();
+        if (c < ' ' || key.getModifiers().isCommandDown() || key.getModifiers().isCtrlDown())
+            return false;
+
+        auto now = juce::Time::getMillisecondCounter();
+        auto extend = !typeAhead.empty() && now - lastTypeAheadMs < typeAheadTimeoutMs;
+        auto ch = juce::String::charToString(c).toStdString();
+        typeAhead = extend ? typeAhead + ch : ch;
+        lastTypeAheadMs = now;
+
+        // A longer prefix may still match the selected row; a new one moves on from it.
+        // Pressing one key repeatedly steps through the rows starting with it.
+        auto repeated = typeAhead.find_first_not_of(ch) == std::string::npos;
+        auto r = data->findRowWithPrefix(typeAhead, extend ? sel : (sel + 1) % n);
+        if (r < 0 && repeated)
+            r = data->findRowWithPrefix(ch, (sel + 1) % n);
+        if (r >= 0)
+            setSelectedRow(r);
     }
+    return true;
+}
 
-    if (doRecalc)
+bool TabularizedTreeViewer::onFrame(double nowMs)
+{
+    if (!data)
+        return false;
+    return data->expandSome(expandRowsPerFrame);
+}
+TabularizedTreeViewerHeader::TabularizedTreeViewerHeader()
+    : style::StyleConsumer(TabularizedTreeViewer::Styles::styleClass)
+{
+}
+
+void TabularizedTreeViewerHeader::paint(juce::Graphics &g)
+{
+    SST_JUCEGUI_PROFILE_SCOPE("paint");
+    if (!viewer || !viewer->getSource())
+        return;
+
+    using Styles = TabularizedTreeViewer::Styles;
+    auto src = viewer->getSource();
+    g.setFont(getFont(Styles::controlLabelFont));
+    for (uint32_t c = 0; c < src->getColumnCount(); ++c)
     {
-        recalcRowDisplayCache();
-        repaint();
+        auto b = viewer->getColumnBounds(c, getLocalBounds());
+        auto t = src->getColumnInfo(c).name;
+        if ((int)c == src->getSortColumn())
+            t += src->isSortAscending() ? " ^" : " v";
+        g.setColour(getColour(Styles::controlLabelCol));
+        g.drawText(t, b.reduced(4, 0), juce::Justification::centredLeft);
+        g.setColour(getColour(Styles::connectorcol));
+        g.fillRect(b.withLeft(b.getRight() - 1));
     }
+    g.fillRect(getLocalBounds().withTop(getHeight() - 1));
+}
+
+void TabularizedTreeViewerHeader::mouseUp(const juce::MouseEvent &e)
+{
+    SST_JUCEGUI_PROFILE_SCOPE("mouseUp");
+    if (!viewer || !viewer->getSource() || !viewer->getSource()->canSort())
+        return;
+
+    auto src = viewer->getSource();
+    for (uint32_t c = 0; c < src->getColumnCount(); ++c)
+    {
+        if (viewer->getColumnBounds(c, getLocalBounds()).contains(e.getPosition()))
+        {
+            auto asc = (int)c == src->getSortColumn() ? !src->isSortAscending() : true;
+            src->setSortColumn(c, asc);
+            repaint();
+            return;
+        }
+    }
+}
+
+void TabularizedTreeViewer::describeFootprint(util::Footprint &f) const
+{
+    StyleConsumer::describeFootprint(f);
+    describeEditableFootprint(f);
+    f.addHeap("typeAhead", util::heapBytesOf(typeAhead));
+    f.addHeap("columnWidths", util::heapBytesOf(columnWidths));
 }
 } // namespace sst::jucegui::components
\ No newline at end of file
@@ -29,6 +29,7 @@ ToggleButton::~ToggleButton()
 
 void ToggleButton::paint(juce::Graphics &g)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("paint");
     float rectCorner = 1.5;
 
     if (label.empty() && data)
@@ -72,15 +73,27 @@ void ToggleButton::paint(juce::Graphics &g)
     g.drawRoundedRectangle(b, rectCorner, 1);
 }
 
-void ToggleButton::mouseDown(const juce::MouseEvent &e) { onBeginEdit(); }
+void ToggleButton::mouseDown(const juce::MouseEvent &e)
+{
+    SST_JUCEGUI_PROFILE_SCOPE("mouseDown");
+    beginEdit();
+}
 
 void ToggleButton::mouseUp(const juce::MouseEvent &e)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("mouseUp");
     if (data)
-        data->setValueFromGUI(!data->getValue());
-    onEndEdit();
+        setValueFromGUIJournaled(data, !data->getValue());
+    endEdit();
     repaint();
 }
 
 void ToggleButton::dataChanged() { repaint(); }
+
+void ToggleButton::describeFootprint(util::Footprint &f) const
+{
+    StyleConsumer::describeFootprint(f);
+    describeEditableFootprint(f);
+    f.addHeap("label", util::heapBytesOf(label));
+}
 } // namespace sst::jucegui::components
\ No newline at end of file
@@ -25,11 +25,13 @@ namespace sst::jucegui::components
 {
 struct subordinateDiscrete : data::Discrete
 {
+    ToggleButtonRadioGroup *group{nullptr};
     data::Discrete *under{nullptr};
     int idx{0};
-    subordinateDiscrete(data::Discrete *d, int i) : under(d), idx(i)
+    subordinateDiscrete(ToggleButtonRadioGroup *g, data::Discrete *d, int i)
+        : group(g), under(d), idx(i)
     {
-        assert(under && idx >= under->getMin() && idx <= under->getMax());
+        assert(group && under && idx >= under->getMin() && idx <= under->getMax());
     }
     virtual ~subordinateDiscrete() = default;
 
@@ -40,7 +42,7 @@ struct subordinateDiscrete : data::Discrete
     {
         if (f)
         {
-            under->setValueFromGUI(idx);
+            group->selectFromButton(idx);
         }
     }
     void setValueFromModel(const int &f) override {}
@@ -59,8 +61,14 @@ ToggleButtonRadioGroup::~ToggleButtonRadioGroup()
 
 void ToggleButtonRadioGroup::resized()
 {
+    SST_JUCEGUI_PROFILE_SCOPE("resized");
     if (buttons.empty())
         return;
+    if (laidOutBounds == getLocalBounds() && laidOutButtons == buttons.size())
+        return;
+    laidOutBounds = getLocalBounds();
+    laidOutButtons = buttons.size();
+
     auto nb = buttons.size();
     auto npad = nb - 1;
     auto margin = 2;
@@ -74,26 +82,42 @@ void ToggleButtonRadioGroup::resized()
     }
 }
 
+void ToggleButtonRadioGroup::clearButtons()
+{
+    for (const auto &b : buttons)
+        removeChildComponent(b.get());
+    buttons.clear();
+    buttonSubData.clear();
+    laidOutButtons = 0;
+}
+
 void ToggleButtonRadioGroup::dataChanged()
 {
-    auto nBut = data ? (data->getMax() - data->getMin() + 1) : 0;
-    if (!data || nBut != buttons.size())
+    auto nBut = data ? (size_t)(data->getMax() - data->getMin() + 1) : 0;
+    if (!data)
     {
-        for (const auto &b : buttons)
-            removeChildComponent(b.get());
-        buttons.clear();
-        buttonSubData.clear();
+        clearButtons();
+        return;
     }
-    if (!data)
+    if (nBut == buttons.size())
+    {
+        // A value change; the buttons read their state through the sub data so only
+        // labels can be stale
+        for (size_t i = 0; i < nBut; ++i)
+            buttons[i]->setLabel(data->getValueAsStringFor((int)i));
+        repaint();
         return;
+    }
 
-    for (int i = 0; i < nBut; ++i)
+    clearButtons();
+
+    for (int i = 0; i < (int)nBut; ++i)
     {
         auto b = std::make_unique<ToggleButton>();
         b->setLabel(data->getValueAsStringFor(i));
         addAndMakeVisible(*b);
 
-        auto sd = std::make_unique<subordinateDiscrete>(data, i);
+        auto sd = std::make_unique<subordinateDiscrete>(this, data, i);
         b->setSource(sd.get());
 
         buttons.push_back(std::move(b));
@@ -101,4 +125,24 @@ void ToggleButtonRadioGroup::dataChanged()
     }
     resized();
 }
+
+void ToggleButtonRadioGroup::selectFromButton(int idx)
+{
+    if (!data)
+        return;
+    beginEdit();
+    setValueFromGUIJournaled(data, idx);
+    endEdit();
+}
+
+void ToggleButtonRadioGroup::describeFootprint(util::Footprint &f) const
+{
+    StyleConsumer::describeFootprint(f);
+    describeEditableFootprint(f);
+    f.addHeap("label", util::heapBytesOf(label));
+    // the buttons are children and counted as such
+    f.addHeap("buttons", util::heapBytesOf(buttons));
+    f.addHeap("buttonSubData", util::heapBytesOf(buttonSubData) +
+                                   buttonSubData.size() * sizeof(data::Discrete));
+}
 } // namespace sst::jucegui::components
\ No newline at end of file
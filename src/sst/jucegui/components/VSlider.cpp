@@ -27,6 +27,7 @@ VSlider::~VSlider() = default;
 
 void VSlider::paint(juce::Graphics &g)
 {
+    SST_JUCEGUI_PROFILE_SCOPE("paint");
     if (!source)
     {
         g.fillAll(juce::Colours::red);
@@ -65,14 +66,14 @@ void VSlider::paint(juce::Graphics &g)
         g.fillRoundedRectangle(gutter.reduced(2), gutterwidth * 0.25);
     }
 
-    auto v = source->getValue01();
+    auto v = getDisplayValue01();
     auto h = (1.0 - v) * gutter.getHeight();
     auto hc = gutter.withTrimmedTop(h).withHeight(1).expanded(0, 4).getCentre();
 
     if (source->isBipolar())
     {
         auto t = hc.getY();
-        auto b = gutter.getHeight() / 2 + gutter.getY();
+        auto b = (1 - source->valueTo01(0.f)) * gutter.getHeight() + gutter.getY();
         if (t > b)
             std::swap(t, b);
         auto val = gutter.withTop(t).withBottom(b);
@@ -118,6 +119,11 @@ void VSlider::paint(juce::Graphics &g)
             g.fillRoundedRectangle(val, gutterwidth * 0.25);
         }
     }
+    paintLiveModulation(g, getColour(Styles::modhandlecol), 2.f, [gutter](float lv) {
+        return juce::Point<float>(gutter.getCentreX(),
+                                  gutter.getY() + (1 - lv) * gutter.getHeight());
+    });
+
     g.setColour(getColour(Styles::handlecol));
     g.fillEllipse(hr);
     g.setColour(getColour(Styles::handlebordercol));
@@ -129,4 +135,9 @@ void VSlider::paint(juce::Graphics &g)
     }
 }
 
+void VSlider::describeFootprint(util::Footprint &f) const
+{
+    StyleConsumer::describeFootprint(f);
+    describeEditorFootprint(f);
+}
 } // namespace sst::jucegui::components
\ No newline at end of file
@@ -0,0 +1,180 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#include <sst/jucegui/data/EditJournal.h>
+#include <juce_gui_basics/juce_gui_basics.h> // Discrete.h asserts with jassert
+#include <sst/jucegui/data/Discrete.h>
+#include <cassert>
+
+namespace sst::jucegui::data
+{
+EditJournal::EditJournal(uint32_t cap) : capacity(cap)
+{
+    assert(capacity > 0);
+    entries = std::make_unique<Entry[]>(capacity);
+}
+
+EditJournal::~EditJournal() = default;
+
+void EditJournal::beginGesture()
+{
+    if (gestureDepth++ == 0)
+        currentGesture++;
+}
+
+void EditJournal::endGesture()
+{
+    if (gestureDepth == 0)
+        return;
+    if (--gestureDepth > 0)
+        return;
+
+    // A drag which ends where it started is not worth an undo step
+    while (count > 0 && applied == count && at(count - 1).gesture == currentGesture &&
+           at(count - 1).isNoOp())
+    {
+        count--;
+        applied--;
+    }
+}
+
+void EditJournal::recordEdit(Continuous *source, float oldValue, float newValue)
+{
+    Value o, n;
+    o.f = oldValue;
+    n.f = newValue;
+    record(source, false, o, n);
+}
+
+void EditJournal::recordEdit(Discrete *source, int oldValue, int newValue)
+{
+    Value o, n;
+    o.i = oldValue;
+    n.i = newValue;
+    record(source, true, o, n);
+}
+
+void EditJournal::record(Labeled *source, bool isDiscrete, Value oldValue, Value newValue)
+{
+    if (isApplying || !source)
+        return;
+
+    // An edit outside a begin / end pair is a gesture of its own
+    if (gestureDepth == 0)
+        currentGesture++;
+
+    // Recording after an undo discards the redo tail
+    count = applied;
+
+    // Merge with this source's entry in the open gesture. Gestures touch one source or
+    // a few coupled ones, so this walks back one or two entries.
+    for (uint32_t i = count; i > 0 && at(i - 1).gesture == currentGesture; --i)
+    {
+        if (at(i - 1).source == source)
+        {
+            at(i - 1).newValue = newValue;
+            return;
+        }
+    }
+
+    if (count == capacity)
+        dropOldestGesture();
+
+    at(count) = Entry{source, oldValue, newValue, currentGesture, isDiscrete};
+    count++;
+    applied = count;
+}
+
+void EditJournal::dropOldestGesture()
+{
+    if (count == 0)
+        return;
+    // If the gesture being recorded fills the whole ring, lose only its oldest entry
+    auto g = at(0).gesture;
+    do
+    {
+        head = (head + 1) % capacity;
+        count--;
+        applied--;
+    } while (count > 0 && at(0).gesture == g && g != currentGesture);
+}
+
+void EditJournal::apply(Entry &e, bool toNew)
+{
+    auto v = toNew ? e.newValue : e.oldValue;
+    onBeginEdit(e.source);
+    if (e.isDiscrete)
+        static_cast<Discrete *>(e.source)->setValueFromGUI(v.i);
+    else
+        static_cast<Continuous *>(e.source)->setValueFromGUI(v.f);
+    onEndEdit(e.source);
+}
+
+bool EditJournal::undo()
+{
+    if (!canUndo())
+        return false;
+
+    isApplying = true;
+    auto g = at(applied - 1).gesture;
+    while (applied > 0 && at(applied - 1).gesture == g)
+    {
+        apply(at(applied - 1), false);
+        applied--;
+    }
+    isApplying = false;
+    return true;
+}
+
+bool EditJournal::redo()
+{
+    if (!canRedo())
+        return false;
+
+    isApplying = true;
+    auto g = at(applied).gesture;
+    while (applied < count && at(applied).gesture == g)
+    {
+        apply(at(applied), true);
+        applied++;
+    }
+    isApplying = false;
+    return true;
+}
+
+void EditJournal::clear()
+{
+    head = 0;
+    count = 0;
+    applied = 0;
+}
+
+void EditJournal::forgetSource(Labeled *source)
+{
+    uint32_t w{0}, newApplied{0};
+    for (uint32_t r = 0; r < count; ++r)
+    {
+        if (at(r).source == source)
+            continue;
+        if (r < applied)
+            newApplied++;
+        at(w++) = at(r);
+    }
+    count = w;
+    applied = newApplied;
+}
+} // namespace sst::jucegui::data
@@ -0,0 +1,357 @@
+/*
+ * sst-juce-guil - an open source library of juce widgets
+ * built by Surge Synth Team.
+ *
+ * Copyright 2023, various authors, as described in the GitHub
+ * transaction log.
+ *
+ * sst-basic-blocks is released under the MIT license, as described
+ * by "LICENSE.md" in this repository. This means you may use this
+ * in commercial software if you are a JUCE Licensee. If you use JUCE
+ * in the open source / GPL3 context, your combined work must be
+ * released under GPL3.
+ *
+ * All source in sst-juce-gui available at
+ * https://github.com/surge-synthesizer/sst-juce-gui
+ */
+
+#include <sst/jucegui/data/TreeSearchIndex.h>
+#include <algorithm>
+#include <string_view>
+#include <unordered_set>
+
+namespace sst::jucegui::data
+{
+TreeSearchIndex::TreeSearchIndex(const TreeTableData &d) : data(d)
+{
+    start();
+    data.addDataListener(this);
+}
+
+TreeSearchIndex::~TreeSearchIndex() { data.removeDataListener(this); }
+
+void TreeSearchIndex::start()
+{
+    auto r = data.getRoot().get();
+    auto id = addNode(r, noParent, 0, 0);
+    if (r->hasChildren())
+    {
+        nodes[id].queued = true;
+        pending.push_back(id);
+    }
+}
+
+uint32_t TreeSearchIndex::addNode(TreeTableData::Entry *e, uint32_t parent, uint32_t childIndex,
+                                  uint16_t depth)
+{
+    auto id = (uint32_t)nodes.size();
+    nodes.push_back(Node{e, parent, childIndex, 0, depth, false});
+    nodeByEntry[e] = id;
+
+    auto l = lowerCased(e->getLabel());
+    labels += l;
+    labelStart.push_back(labels.size());
+
+    for (size_t i = 0; i + 3 <= l.size(); ++i)
+    {
+        auto &pl = postings[trigramAt(l, i)];
+        if (pl.empty() || pl.back() != id)
+            pl.push_back(id);
+    }
+    return id;
+}
+
+int TreeSearchIndex::nodeFor(const TreeTableData::Entry *e) const
+{
+    auto it = nodeByEntry.find(e);
+    if (it == nodeByEntry.end())
+        return -1;
+    return it->second;
+}
+
+bool TreeSearchIndex::indexSome(uint32_t budget)
+{
+    uint32_t added{0};
+    while (added < budget && !pending.empty())
+    {
+        auto id = pending.front();
+        auto e = nodes[id].entry;
+        auto n = e->getChildCount();
+        while (nodes[id].childrenIndexed < n && added < budget)
+        {
+            auto ci = nodes[id].childrenIndexed++;
+            auto c = e->getChildAt(ci).get();
+            auto cid = addNode(c, id, ci, nodes[id].depth + 1);
+            if (c->hasChildren())
+            {
+                nodes[cid].queued = true;
+                pending.push_back(cid);
+            }
+            added++;
+        }
+        if (nodes[id].childrenIndexed >= n)
+        {
+            nodes[id].queued = false;
+            pending.pop_front();
+        }
+    }
+    if (added > 0)
+        generation++;
+    return !pending.empty();
+}
+
+void TreeSearchIndex::childrenAdded(TreeTableData::Entry *parent, uint32_t from, uint32_t count)
+{
+    auto id = nodeFor(parent);
+    if (id < 0 || nodes[id].queued)
+        return;
+    nodes[id].queued = true;
+    pending.push_back(id);
+}
+
+void TreeSearchIndex::childrenReplaced(TreeTableData::Entry *parent)
+{
+    // Nothing indexed refers to the children of a parent not yet walked
+    auto indexed = !parent;
+    if (parent)
+    {
+        auto id = nodeFor(parent);
+        indexed = id >= 0 && nodes[id].childrenIndexed > 0;
+    }
+    if (indexed)
+        startOver();
+
+    for (auto *l : indexListeners)
+        l->childrenReindexed(parent);
+}
+
+void TreeSearchIndex::startOver()
+{
+    // Posting lists cannot drop ids cheaply, so index again from the root
+    nodes.clear();
+    nodeByEntry.clear();
+    pending.clear();
+    labels.clear();
+    labelStart.assign(1, 0);
+    postings.clear();
+    lastQuery.clear();
+    lastResult.clear();
+    generation++;
+    resets++;
+    start();
+}
+
+bool TreeSearchIndex::labelContains(uint32_t id, const std::string &lq) const
+{
+    auto l = std::string_view(labels).substr(labelStart[id], labelStart[id + 1] - labelStart[id]);
+    return l.find(lq) != std::string_view::npos;
+}
+
+const std::vector<uint32_t> &TreeSearchIndex::query(const std::string &q)
+{
+    auto lq = lowerCased(q);
+    auto refines = generation == lastGeneration && !lastQuery.empty() &&
+                   lq.find(lastQuery) != std::string::npos;
+    lastQuery = lq;
+    lastGeneration = generation;
+
+    if (lq.empty())
+    {
+        lastResult.resize(nodes.size());
+        for (uint32_t i = 0; i < nodes.size(); ++i)
+            lastResult[i] = i;
+        return lastResult;
+    }
+
+    if (refines)
+    {
+        // Anything matching the longer query matched the shorter one
+        lastResult.erase(std::remove_if(lastResult.begin(), lastResult.end(),
+                                        [&](auto id) { return !labelContains(id, lq); }),
+                         lastResult.end());
+        return lastResult;
+    }
+
+    lastResult.clear();
+    if (lq.size() < 3)
+    {
+        for (uint32_t i = 0; i < nodes.size(); ++i)
+            if (labelContains(i, lq))
+                lastResult.push_back(i);
+        return lastResult;
+    }
+
+    // Intersect the posting lists, shortest first, then confirm the survivors
+    std::vector<const std::vector<uint32_t> *> lists;
+    for (size_t i = 0; i + 3 <= lq.size(); ++i)
+    {
+        auto it = postings.find(trigramAt(lq, i));
+        if (it == postings.end())
+            return lastResult;
+        lists.push_back(&it->second);
+    }
+    std::sort(lists.begin(), lists.end(), [](auto a, auto b) { return a->size() < b->size(); });
+
+    lastResult = *lists[0];
+    for (size_t i = 1; i < lists.size() && !lastResult.empty(); ++i)
+    {
+        if (lists[i] == lists[i - 1])
+            continue;
+        scratch.clear();
+        std::set_intersection(lastResult.begin(), lastResult.end(), lists[i]->begin(),
+                              lists[i]->end(), std::back_inserter(scratch));
+        std::swap(lastResult, scratch);
+    }
+    lastResult.erase(std::remove_if(lastResult.begin(), lastResult.end(),
+                                    [&](auto id) { return !labelContains(id, lq); }),
+                     lastResult.end());
+    return lastResult;
+}
+
+FilteredTabularizedViewOfTree::FilteredTabularizedViewOfTree(TreeSearchIndex &idx) : index(idx)
+{
+    index.addIndexListener(this);
+}
+
+FilteredTabularizedViewOfTree::~FilteredTabularizedViewOfTree() { index.removeIndexListener(this); }
+
+bool FilteredTabularizedViewOfTree::dropIfIndexReset()
+{
+    if (builtForReset == index.getResetCount())
+        return false;
+    builtForReset = index.getResetCount();
+
+    auto oldCount = (uint32_t)rows.size();
+    includedChildren.clear();
+    rows.clear();
+    if (oldCount > 0)
+        rowsWereRemoved(0, oldCount);
+    return true;
+}
+
+void FilteredTabularizedViewOfTree::childrenReindexed(TreeTableData::Entry *parent)
+{
+    if (dropIfIndexReset())
+        return;
+
+    // Rows below parent are only shown with parent itself, as an ancestor of a match
+    auto shown = !parent;
+    for (uint32_t i = 0; i < rows.size() && !shown; ++i)
+        shown = rows[i].entry == parent;
+    if (!shown)
+        return;
+
+    auto oldCount = (uint32_t)rows.size();
+    includedChildren.clear();
+    rows.clear();
+    if (oldCount > 0)
+        rowsWereRemoved(0, oldCount);
+}
+
+void FilteredTabularizedViewOfTree::setQuery(const std::string &q)
+{
+    if (q != query)
+        closedIds.clear();
+    query = q;
+    refresh();
+}
+
+TabularizedTreeView::TabularizedRow FilteredTabularizedViewOfTree::rowFor(uint32_t id) const
+{
+    assert(id < index.getNodeCount());
+    const auto &n = index.getNode(id);
+    auto tr = TabularizedRow();
+    tr.entry = n.entry;
+    tr.childIndex = n.childIndex;
+    tr.depth = n.depth;
+    tr.type = includedChildren.count(id) ? TabularizedRow::CLOSED : TabularizedRow::NODE;
+    return tr;
+}
+
+void FilteredTabularizedViewOfTree::appendRows(std::vector<TabularizedRow> &out,
+                                               uint32_t id) const
+{
+    auto tr = rowFor(id);
+    auto kids = includedChildren.find(id);
+    auto isOpen = kids != includedChildren.end() && !closedIds.count(idOf(tr.entry));
+    if (isOpen)
+        tr.type = TabularizedRow::OPEN;
+    out.push_back(tr);
+    if (isOpen)
+        for (auto k : kids->second)
+            appendRows(out, k);
+}
+
+void FilteredTabularizedViewOfTree::refresh()
+{
+    const auto &matches = index.query(query);
+    builtForReset = index.getResetCount();
+
+    // Each match and its chain of ancestors, stopping where a chain joins one seen before
+    includedChildren.clear();
+    std::unordered_set<uint32_t> included;
+    for (auto id : matches)
+    {
+        while (id != TreeSearchIndex::noParent && included.insert(id).second)
+        {
+            auto p = index.getNode(id).parent;
+            if (p != TreeSearchIndex::noParent)
+                includedChildren[p].push_back(id);
+            id = p;
+        }
+    }
+    // ids are handed out in child order within a parent
+    for (auto &[p, kids] : includedChildren)
+        std::sort(kids.begin(), kids.end());
+
+    // Patch rather than rebuild, so a growing index keeps the selection and scroll
+    std::vector<TabularizedRow> fresh;
+    if (!included.empty())
+        appendRows(fresh, 0);
+    patchRows(rows, 0, rows.size(), fresh);
+}
+
+void FilteredTabularizedViewOfTree::open(int r)
+{
+    assert(r >= 0 && r < rows.size());
+    assert(rows[r].type == TabularizedRow::CLOSED);
+    if (dropIfIndexReset())
+        return;
+    auto id = index.nodeFor(rows[r].entry);
+    if (id < 0)
+        return;
+
+    rows[r].type = TabularizedRow::OPEN;
+    closedIds.erase(idOf(rows[r].entry));
+    std::vector<TabularizedRow> add;
+    auto kids = includedChildren.find(id);
+    if (kids != includedChildren.end())
+        for (auto k : kids->second)
+            appendRows(add, k);
+    rows.insert(r + 1, add.size(), [&](size_t i) { return add[i]; });
+
+    for (auto *l : listeners)
+        l->rowChanged(r);
+    if (!add.empty())
+        rowsWereInserted(r + 1, add.size());
+}
+
+void FilteredTabularizedViewOfTree::close(int r)
+{
+    assert(r >= 0 && r < rows.size());
+    assert(rows[r].type == TabularizedRow::OPEN);
+
+    rows[r].type = TabularizedRow::CLOSED;
+    closedIds.insert(idOf(rows[r].entry));
+    auto d = rows[r].depth;
+    uint32_t end = r + 1;
+    while (end < rows.size() && rows[end].depth > d)
+        end++;
+    rows.erase(r + 1, end - r - 1);
+
+    for (auto *l : listeners)
+        l->rowChanged(r);
+    if (end > r + 1)
+        rowsWereRemoved(r + 1, end - r - 1);
+}
+} // namespace sst::jucegui::data
@@ -16,27 +16,128 @@
  */
 
 #include <sst/jucegui/data/TreeTable.h>
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+#include <unordered_set>
+#include <cctype>
+#include <cstdio>
+#include <ctime>
 
 namespace sst::jucegui::data
 {
-ConcreteTabularizedViewOfTree::ConcreteTabularizedViewOfTree(const TreeTableData &d) : data(d)
+std::string lowerCased(std::string s)
 {
-    auto tr = TabularizedRow();
-    if (d.getRoot()->hasChildren())
+    for (auto &c : s)
+        if (c >= 'A' && c <= 'Z')
+            c = c - 'A' + 'a';
+    return s;
+}
+
+namespace
+{
+bool startsWith(const std::string &s, const std::string &prefix)
+{
+    return s.compare(0, prefix.size(), prefix) == 0;
+}
+} // namespace
+
+std::string ColumnValue::toDisplayString() const
+{
+    char buf[64];
+    switch (type)
     {
-        tr.type = TabularizedRow::CLOSED;
+    case NONE:
+        return {};
+    case STRING:
+        return s;
+    case INTEGER:
+        return std::to_string(i);
+    case FLOAT:
+        snprintf(buf, sizeof(buf), "%.2f", f);
+        return buf;
+    case SIZE:
+    {
+        static constexpr const char *units[] = {"B", "KB", "MB", "GB", "TB"};
+        double v = i;
+        int u = 0;
+        while (v >= 1024 && u < 4)
+        {
+            v /= 1024;
+            u++;
+        }
+        if (u == 0)
+            snprintf(buf, sizeof(buf), "%d B", (int)i);
+        else
+            snprintf(buf, sizeof(buf), "%.1f %s", v, units[u]);
+        return buf;
     }
-    else
+    case DATE:
+    {
+        // std::localtime shares one buffer between threads, so fill our own
+        auto t = (std::time_t)(i / 1000);
+        std::tm tm{};
+#if defined(_WIN32)
+        auto ok = localtime_s(&tm, &t) == 0;
+#else
+        auto ok = localtime_r(&t, &tm) != nullptr;
+#endif
+        if (!ok || !std::strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M", &tm))
+            return {};
+        return buf;
+    }
+    }
+    return {};
+}
+
+int ColumnValue::compare(const ColumnValue &a, const ColumnValue &b)
+{
+    if (a.type != b.type)
+        return (int)a.type - (int)b.type;
+    switch (a.type)
+    {
+    case NONE:
+        return 0;
+    case STRING:
+    {
+        auto n = std::min(a.s.size(), b.s.size());
+        for (size_t k = 0; k < n; ++k)
+        {
+            auto ca = std::tolower((unsigned char)a.s[k]), cb = std::tolower((unsigned char)b.s[k]);
+            if (ca != cb)
+                return ca - cb;
+        }
+        return (int)(a.s.size() > b.s.size()) - (int)(a.s.size() < b.s.size());
+    }
+    case FLOAT:
+        return (a.f > b.f) - (a.f < b.f);
+    default:
+        return (a.i > b.i) - (a.i < b.i);
+    }
+}
+
+int TabularizedTreeView::findRowWithPrefix(const std::string &prefix, uint32_t from)
+{
+    auto n = getRowCount();
+    auto lp = lowerCased(prefix);
+    for (uint32_t k = 0; k < n; ++k)
     {
-        tr.type = TabularizedRow::NODE;
+        auto i = (from + k) % n;
+        const auto &row = getRow(i);
+        if (row.type != TabularizedRow::PLACEHOLDER && startsWith(lowerCased(row.getLabel()), lp))
+            return i;
     }
-    tr.label = d.getRoot()->getLabel();
-    tr.path = {};
-    tr.depth = 0;
+    return -1;
+}
 
-    rows.push_back(tr);
+ConcreteTabularizedViewOfTree::ConcreteTabularizedViewOfTree(const TreeTableData &d) : data(d)
+{
+    rows.push_back(rowForRoot());
+    data.addDataListener(this);
 }
 
+ConcreteTabularizedViewOfTree::~ConcreteTabularizedViewOfTree() { data.removeDataListener(this); }
+
 uint32_t ConcreteTabularizedViewOfTree::getRowCount() const { return rows.size(); }
 
 void ConcreteTabularizedViewOfTree::open(int r)
@@ -44,69 +145,642 @@ void ConcreteTabularizedViewOfTree::open(int r)
     assert(r >= 0 && r < rows.size());
     assert(rows[r].type == TabularizedRow::CLOSED);
 
-    const auto &row = rows[r];
+    rows[r].type = TabularizedRow::OPEN;
+    rowMap.valid = false;
+    auto e = rows[r].entry;
+    expandedIds.insert(idOf(e));
 
-    // This is pretty inefficient but
-    auto newRows = rows_t();
-    for (int i = 0; i <= r; ++i)
-        newRows.push_back(rows[i]);
+    // What has loaded so far, with anything open below it before, and a placeholder for
+    // the rest while loading
+    std::vector<TabularizedRow> add;
+    appendChildren(add, e, rows[r].depth + 1);
+    rows.insert(r + 1, add.size(), [&](size_t i) { return add[i]; });
 
-    newRows[r].type = TabularizedRow::OPEN;
+    for (auto *l : listeners)
+        l->rowChanged(r);
+    if (!add.empty())
+        rowsWereInserted(r + 1, add.size());
+}
+
+void ConcreteTabularizedViewOfTree::close(int r)
+{
+    assert(r >= 0 && r < rows.size());
+    assert(rows[r].type == TabularizedRow::OPEN);
+
+    rows[r].type = TabularizedRow::CLOSED;
+    rowMap.valid = false;
+    expandedIds.erase(idOf(rows[r].entry));
+
+    // An expansion still walking this row must not go on to emit its children under it.
+    // They may not be out yet, so there may be no rows below to remove to end it.
+    auto e = rows[r].entry;
+    if (isBeingExpanded(e))
+    {
+        if ((uint32_t)r == expansion.rootRow)
+            expansion.stack.clear();
+        else
+            expansion.stack.erase(std::find_if(expansion.stack.begin(), expansion.stack.end(),
+                                               [e](const auto &c) { return c.entry == e; }),
+                                  expansion.stack.end());
+    }
+
+    auto end = subtreeEnd(r);
+    rows.erase(r + 1, end - r - 1);
+
+    for (auto *l : listeners)
+        l->rowChanged(r);
+    if (end > r + 1)
+        rowsWereRemoved(r + 1, end - r - 1);
+}
+
+const ConcreteTabularizedViewOfTree::PrefixIndex &
+ConcreteTabularizedViewOfTree::prefixIndexFor(TreeTableData::Entry *e)
+{
+    auto &pi = prefixIndex[e];
+    auto n = e->getChildCount();
+    if (pi.child.size() == n)
+        return pi;
 
-    // Now do the open. This is rather clumsy
-    auto e = data.getRoot().get();
-    for (const auto &idx : row.path)
+    std::vector<std::pair<std::string, uint32_t>> sorted;
+    sorted.reserve(n);
+    for (uint32_t i = 0; i < n; ++i)
+        sorted.emplace_back(lowerCased(e->getChildAt(i)->getLabel()), i);
+    std::sort(sorted.begin(), sorted.end());
+    pi.labels.resize(n);
+    pi.child.resize(n);
+    for (uint32_t k = 0; k < n; ++k)
     {
-        e = e->getChildAt(idx).get();
+        pi.labels[k] = std::move(sorted[k].first);
+        pi.child[k] = sorted[k].second;
     }
-    auto p = row.path;
-    for (int i = 0; i < e->getChildCount(); ++i)
+    return pi;
+}
+
+const ConcreteTabularizedViewOfTree::RowMap &ConcreteTabularizedViewOfTree::rowMapFor()
+{
+    if (rowMap.valid)
+        return rowMap;
+    rowMap.rowOf.clear();
+    rowMap.openRows.clear();
+    for (uint32_t i = 0; i < rows.size(); ++i)
     {
-        const auto &q = e->getChildAt(i);
-        auto tr = TabularizedRow();
-        tr.label = q->getLabel();
-        tr.type = q->hasChildren() ? TabularizedRow::CLOSED : TabularizedRow::NODE;
-        tr.depth = row.depth + 1;
-        tr.path = p;
-        tr.path.push_back(i);
+        const auto &row = rows[i];
+        if (row.type == TabularizedRow::PLACEHOLDER)
+            continue;
+        rowMap.rowOf[row.entry] = i;
+        if (row.type == TabularizedRow::OPEN)
+            rowMap.openRows.push_back(i);
+    }
+    rowMap.valid = true;
+    return rowMap;
+}
 
-        newRows.push_back(tr);
+int ConcreteTabularizedViewOfTree::findRowWithPrefix(const std::string &prefix, uint32_t from)
+{
+    if (rows.size() == 0)
+        return -1;
+    from %= rows.size();
+    auto lp = lowerCased(prefix);
+    const auto &rm = rowMapFor();
+
+    // The first matching row at or after from, else the first matching row at all
+    int after{-1}, first{-1};
+    auto consider = [&](int row) {
+        if (row >= (int)from && (after < 0 || row < after))
+            after = row;
+        if (first < 0 || row < first)
+            first = row;
+    };
+
+    // Every row but the root is a child of an open row, and the children of one which
+    // match are a range of its prefix index, so this costs a binary search per open row
+    // and a lookup per match
+    if (startsWith(lowerCased(rows[0].getLabel()), lp))
+        consider(0);
+    for (auto r : rm.openRows)
+    {
+        auto e = rows[r].entry;
+        const auto &pi = prefixIndexFor(e);
+        auto lo = std::lower_bound(pi.labels.begin(), pi.labels.end(), lp);
+        for (auto it = lo; it != pi.labels.end() && startsWith(*it, lp); ++it)
+        {
+            auto row = rm.rowOf.find(e->getChildAt(pi.child[it - pi.labels.begin()]).get());
+            if (row != rm.rowOf.end())
+                consider(row->second);
+        }
     }
+    return after >= 0 ? after : first;
+}
 
-    for (int i = r + 1; i < rows.size(); ++i)
-        newRows.push_back(rows[i]);
+uint32_t ConcreteTabularizedViewOfTree::subtreeEnd(uint32_t r) const
+{
+    // The open descendants of r are exactly the deeper rows which follow it
+    auto d = rows[r].depth;
+    auto end = r + 1;
+    while (end < rows.size() && rows[end].depth > d)
+        end++;
+    return end;
+}
+
+int ConcreteTabularizedViewOfTree::openRowFor(const TreeTableData::Entry *e)
+{
+    if (!expandedIds.count(idOf(e)))
+        return -1;
 
-    rows = newRows;
+    auto hint = openRowHint.find(e);
+    if (hint != openRowHint.end() && hint->second < rows.size() &&
+        rows[hint->second].entry == e && rows[hint->second].type == TabularizedRow::OPEN)
+        return hint->second;
+
+    // The row map answers misses, hidden entries included, until the rows next change
+    const auto &rm = rowMapFor();
+    auto it = rm.rowOf.find(e);
+    if (it == rm.rowOf.end() || rows[it->second].type != TabularizedRow::OPEN)
+        return -1;
+    openRowHint[e] = it->second;
+    return it->second;
 }
 
-void ConcreteTabularizedViewOfTree::close(int r)
+void ConcreteTabularizedViewOfTree::childrenAdded(TreeTableData::Entry *parent, uint32_t from,
+                                                  uint32_t count)
 {
-    assert(r >= 0 && r < rows.size());
-    assert(rows[r].type == TabularizedRow::OPEN);
+    // An expansion still walking this entry reads its live child count as it goes
+    if (isBeingExpanded(parent))
+        return;
+
+    auto r = openRowFor(parent);
+    if (r < 0)
+        return;
+
+    // New children go just before the placeholder. Count what is already shown rather
+    // than trusting `from`, in case the row was opened after the batch landed.
+    auto end = subtreeEnd(r);
+    auto at = end;
+    if (isPlaceholderFor(at - 1, r))
+        at--;
+    uint32_t shown{0};
+    for (auto i = (uint32_t)r + 1; i < at; ++i)
+        shown += (rows[i].depth == rows[r].depth + 1);
+
+    auto upTo = std::min(from + count, parent->getChildCount());
+    if (upTo <= shown)
+        return;
 
-    auto newRows = rows_t();
+    // Any cached order of these children is now short
+    sortCache.erase(sortCache.lower_bound({parent, INT32_MIN}),
+                    sortCache.upper_bound({parent, INT32_MAX}));
 
-    int idx = 0;
-    while (idx <= r)
+    auto d = rows[r].depth;
+    std::vector<TabularizedRow> add;
+    for (auto k = shown; k < upTo; ++k)
+        appendRow(add, rowForChild(parent, k, d + 1));
+    rows.insert(at, add.size(), [&](size_t i) { return add[i]; });
+
+    rowsWereInserted(at, add.size());
+}
+
+void ConcreteTabularizedViewOfTree::childrenComplete(TreeTableData::Entry *parent)
+{
+    if (isBeingExpanded(parent))
+        return;
+
+    auto r = openRowFor(parent);
+    if (r < 0)
+        return;
+
+    // pick up anything not yet announced, then drop the placeholder
+    childrenAdded(parent, 0, parent->getChildCount());
+
+    if (sortColumn >= 0)
     {
-        newRows.push_back(rows[idx]);
-        idx++;
+        // They arrived in natural order. Sort just these and patch them into place, which
+        // also drops the placeholder, so rows elsewhere keep their hover and selection.
+        patchChildren(r);
+        return;
     }
-    auto d = newRows.back().depth;
-    newRows.back().type = TabularizedRow::CLOSED;
 
-    while (d < rows[idx].depth && idx < rows.size())
+    auto end = subtreeEnd(r);
+    if (isPlaceholderFor(end - 1, r))
     {
-        idx++;
+        rows.erase(end - 1, 1);
+        rowsWereRemoved(end - 1, 1);
     }
+}
 
-    while (idx < rows.size())
+void ConcreteTabularizedViewOfTree::childrenReplaced(TreeTableData::Entry *parent)
+{
+    // Entries below parent may be new objects, so nothing remembered by address holds.
+    // Sort orders and prefix indices are recomputed as rows need them.
+    expansion.stack.clear();
+    sortCache.clear();
+    prefixIndex.clear();
+    openRowHint.clear();
+    rowMap.valid = false;
+
+    if (parent)
     {
-        newRows.push_back(rows[idx]);
-        idx++;
+        auto r = openRowFor(parent);
+        if (r >= 0)
+            patchChildren(r);
+        return;
     }
 
-    rows = newRows;
+    // A new root only replaces the first row in place. What is under it is patched as for
+    // any other parent, flattening just the open entries.
+    auto root = rowForRoot();
+    if (root.type == TabularizedRow::CLOSED && expandedIds.count(idOf(root.entry)))
+        root.type = TabularizedRow::OPEN;
+    auto changed = rows[0].entry != root.entry || rows[0].type != root.type;
+    rows[0] = root;
+    if (changed)
+        for (auto *l : listeners)
+            l->rowChanged(0);
+
+    if (root.type == TabularizedRow::OPEN)
+    {
+        patchChildren(0);
+    }
+    else if (rows.size() > 1)
+    {
+        auto n = (uint32_t)rows.size() - 1;
+        rows.erase(1, n);
+        rowsWereRemoved(1, n);
+    }
+}
+
+void ConcreteTabularizedViewOfTree::patchChildren(uint32_t r)
+{
+    std::vector<TabularizedRow> fresh;
+    appendChildren(fresh, rows[r].entry, rows[r].depth + 1);
+    patchRows(rows, r + 1, subtreeEnd(r), fresh);
+    // rows patched in place may now show other entries, or be open or closed
+    rowMap.valid = false;
 }
 
+void TabularizedTreeView::patchRows(rows_t &rows, uint32_t from, uint32_t to,
+                                    const std::vector<TabularizedRow> &fresh)
+{
+    /*
+     * Walk the old rows and the fresh ones together. Rows with the same id, depth and
+     * kind are kept in place; runs of rows only in the old list are removed and runs only
+     * in the fresh one inserted, so an add or delete in a large tree costs a delta the
+     * size of the change. A row which moved is removed and inserted at its new place.
+     */
+    auto keyOf = [](const TabularizedRow &tr) {
+        auto k = idOf(tr.entry);
+        return tr.type == TabularizedRow::PLACEHOLDER ? ~k : k;
+    };
+    auto same = [&](const TabularizedRow &a, const TabularizedRow &b) {
+        return keyOf(a) == keyOf(b) && a.depth == b.depth;
+    };
+    std::unordered_map<uint64_t, uint32_t> oldLeft, freshLeft;
+    for (auto i = from; i < to; ++i)
+        oldLeft[keyOf(rows[i])]++;
+    for (const auto &f : fresh)
+        freshLeft[keyOf(f)]++;
+    auto inFresh = [&](const TabularizedRow &tr) {
+        auto it = freshLeft.find(keyOf(tr));
+        return it != freshLeft.end() && it->second > 0;
+    };
+    auto inOld = [&](const TabularizedRow &tr) {
+        auto it = oldLeft.find(keyOf(tr));
+        return it != oldLeft.end() && it->second > 0;
+    };
+
+    auto p = from;
+    size_t j = 0;
+    while (p < to || j < fresh.size())
+    {
+        if (p < to && j < fresh.size() && same(rows[p], fresh[j]))
+        {
+            // the entry may be a new object, or have gained or lost children
+            auto changed = rows[p].entry != fresh[j].entry || rows[p].type != fresh[j].type;
+            oldLeft[keyOf(rows[p])]--;
+            freshLeft[keyOf(fresh[j])]--;
+            rows[p] = fresh[j];
+            if (changed)
+                for (auto *l : listeners)
+                    l->rowChanged(p);
+            p++;
+            j++;
+            continue;
+        }
+
+        uint32_t gone{0};
+        while (p + gone < to && !inFresh(rows[p + gone]))
+            oldLeft[keyOf(rows[p + gone++])]--;
+        if (gone == 0 && j < fresh.size() && inOld(fresh[j]))
+        {
+            // both rows are elsewhere in the other list, so this one moved
+            oldLeft[keyOf(rows[p])]--;
+            gone = 1;
+        }
+        if (gone > 0)
+        {
+            rows.erase(p, gone);
+            to -= gone;
+            rowsWereRemoved(p, gone);
+            continue;
+        }
+
+        uint32_t added{0};
+        while (j + added < fresh.size() && !inOld(fresh[j + added]))
+            freshLeft[keyOf(fresh[j + added++])]--;
+        assert(added > 0);
+        rows.insert(p, added, [&](size_t i) { return fresh[j + i]; });
+        rowsWereInserted(p, added);
+        p += added;
+        to += added;
+        j += added;
+    }
+}
+
+TabularizedTreeView::TabularizedRow ConcreteTabularizedViewOfTree::rowForRoot() const
+{
+    auto tr = TabularizedRow();
+    tr.entry = data.getRoot().get();
+    tr.type = tr.entry->hasChildren() ? TabularizedRow::CLOSED : TabularizedRow::NODE;
+    return tr;
+}
+
+void ConcreteTabularizedViewOfTree::appendRow(std::vector<TabularizedRow> &out,
+                                              TabularizedRow tr)
+{
+    if (tr.type == TabularizedRow::CLOSED && expandedIds.count(idOf(tr.entry)))
+        tr.type = TabularizedRow::OPEN;
+    out.push_back(tr);
+    if (tr.type == TabularizedRow::OPEN)
+        appendChildren(out, tr.entry, tr.depth + 1);
+}
+
+void ConcreteTabularizedViewOfTree::appendChildren(std::vector<TabularizedRow> &out,
+                                                   TreeTableData::Entry *e, uint16_t depth)
+{
+    auto loading = e->getChildState() == TreeTableData::Entry::LOADING;
+    if (loading)
+        e->requestChildren();
+
+    auto n = e->getChildCount();
+    for (uint32_t k = 0; k < n; ++k)
+        appendRow(out, rowForChild(e, childAtPosition(e, k), depth));
+    if (loading)
+    {
+        auto ph = TabularizedRow();
+        ph.entry = e;
+        ph.depth = depth;
+        ph.type = TabularizedRow::PLACEHOLDER;
+        out.push_back(ph);
+    }
+}
+
+TabularizedTreeView::TabularizedRow
+ConcreteTabularizedViewOfTree::rowForChild(TreeTableData::Entry *e, uint32_t idx,
+                                           uint16_t depth) const
+{
+    auto q = e->getChildAt(idx).get();
+    auto tr = TabularizedRow();
+    tr.entry = q;
+    tr.childIndex = idx;
+    tr.type = q->hasChildren() ? TabularizedRow::CLOSED : TabularizedRow::NODE;
+    tr.depth = depth;
+    return tr;
+}
+
+uint32_t ConcreteTabularizedViewOfTree::childAtPosition(TreeTableData::Entry *e, uint32_t k)
+{
+    if (sortColumn < 0 || e->getChildState() == TreeTableData::Entry::LOADING)
+        return k;
+
+    auto n = e->getChildCount();
+    auto &perm = sortCache[{e, sortColumn}];
+    if (perm.size() != n)
+    {
+        std::vector<ColumnValue> vals;
+        vals.reserve(n);
+        for (uint32_t i = 0; i < n; ++i)
+            vals.push_back(e->getChildAt(i)->getDataForColumn(sortColumn));
+        perm.resize(n);
+        std::iota(perm.begin(), perm.end(), 0);
+        std::stable_sort(perm.begin(), perm.end(), [&](auto a, auto b) {
+            return ColumnValue::compare(vals[a], vals[b]) < 0;
+        });
+    }
+    // Descending walks the ascending order backwards, so both share one cache entry
+    return sortAscending ? perm[k] : perm[n - 1 - k];
+}
+
+void ConcreteTabularizedViewOfTree::setSortColumn(int col, bool ascending)
+{
+    if (col == sortColumn && ascending == sortAscending)
+        return;
+    sortColumn = col;
+    sortAscending = ascending;
+    reflatten();
+}
+
+void ConcreteTabularizedViewOfTree::reflatten()
+{
+    // Rebuild only what is shown: the open rows, with their children in the current order
+    expansion.stack.clear();
+    auto oldCount = (uint32_t)rows.size();
+    std::vector<TabularizedRow> fresh;
+    appendRow(fresh, rowForRoot());
+    rows.clear();
+    for (const auto &tr : fresh)
+        rows.push_back(tr);
+
+    rowsWereRemoved(0, oldCount);
+    rowsWereInserted(0, rows.size());
+}
+
+bool ConcreteTabularizedViewOfTree::isPlaceholderFor(uint32_t row, uint32_t parentRow) const
+{
+    return row > parentRow && row < rows.size() &&
+           rows[row].type == TabularizedRow::PLACEHOLDER &&
+           rows[row].depth == rows[parentRow].depth + 1;
+}
+
+void ConcreteTabularizedViewOfTree::rowsWereInserted(uint32_t at, uint32_t count)
+{
+    rowMap.valid = false;
+    if (isExpanding())
+    {
+        if (at <= expansion.rootRow)
+            expansion.rootRow += count;
+        // Rows landing exactly at nextRow are inside the expansion only if deeper than its
+        // root; otherwise they belong to an ancestor and stay after it
+        if (at < expansion.nextRow ||
+            (at == expansion.nextRow && rows[at].depth > rows[expansion.rootRow].depth))
+            expansion.nextRow += count;
+    }
+    for (auto *l : listeners)
+        l->rowsInserted(at, count);
+}
+
+void ConcreteTabularizedViewOfTree::rowsWereRemoved(uint32_t at, uint32_t count)
+{
+    rowMap.valid = false;
+    if (isExpanding())
+    {
+        // Rows it has finished with can go, as close() takes any row still being walked
+        // off the stack first; removing its root or rows after it ends it where it is
+        if (at > expansion.rootRow && at + count <= expansion.nextRow)
+            expansion.nextRow -= count;
+        else if (at + count > expansion.rootRow && at < expansion.nextRow)
+            expansion.stack.clear();
+        else if (at < expansion.rootRow)
+        {
+            expansion.rootRow -= count;
+            expansion.nextRow -= count;
+        }
+    }
+    for (auto *l : listeners)
+        l->rowsRemoved(at, count);
+}
+
+bool ConcreteTabularizedViewOfTree::isBeingExpanded(const TreeTableData::Entry *e) const
+{
+    for (const auto &c : expansion.stack)
+        if (c.entry == e)
+            return true;
+    return false;
+}
+
+void ConcreteTabularizedViewOfTree::expandSubtree(int r, int maxDepth)
+{
+    assert(r >= 0 && r < rows.size());
+    if (!rows[r].isExpandable() || maxDepth <= 0)
+        return;
+
+    if (isExpanding())
+    {
+        auto at = expansion.nextRow;
+        if ((uint32_t)r >= at)
+            r += stopExpansion();
+        else
+            stopExpansion();
+    }
+
+    // Start from a closed row so the subtree streams out in one contiguous run
+    if (rows[r].type == TabularizedRow::OPEN)
+        close(r);
+
+    rows[r].type = TabularizedRow::OPEN;
+    rowMap.valid = false;
+    for (auto *l : listeners)
+        l->rowChanged(r);
+
+    auto e = rows[r].entry;
+    expandedIds.insert(idOf(e));
+    if (e->getChildState() == TreeTableData::Entry::LOADING)
+        e->requestChildren();
+    expansion.rootRow = r;
+    expansion.nextRow = r + 1;
+    expansion.maxDepth = (int)std::min<int64_t>((int64_t)rows[r].depth + maxDepth, UINT16_MAX);
+    expansion.stack.push_back({e, 0, rows[r].depth});
+}
+
+uint32_t ConcreteTabularizedViewOfTree::stopExpansion()
+{
+    // Each level the walk is inside is open but short of the children it has yet to reach.
+    // Give it them as open() would, closed unless they were open before, from the deepest.
+    auto at = expansion.nextRow;
+    std::vector<TabularizedRow> add;
+    while (!expansion.stack.empty())
+    {
+        auto c = expansion.stack.back();
+        expansion.stack.pop_back();
+        for (auto k = c.position; k < c.entry->getChildCount(); ++k)
+            appendRow(add, rowForChild(c.entry, childAtPosition(c.entry, k), c.depth + 1));
+        if (c.entry->getChildState() == TreeTableData::Entry::LOADING)
+        {
+            auto ph = TabularizedRow();
+            ph.entry = c.entry;
+            ph.depth = c.depth + 1;
+            ph.type = TabularizedRow::PLACEHOLDER;
+            add.push_back(ph);
+        }
+    }
+    if (!add.empty())
+    {
+        rows.insert(at, add.size(), [&](size_t i) { return add[i]; });
+        rowsWereInserted(at, add.size());
+    }
+    return add.size();
+}
+
+void ConcreteTabularizedViewOfTree::collapseSubtree(int r)
+{
+    assert(r >= 0 && r < rows.size());
+    if (isExpanding() && expansion.rootRow == (uint32_t)r)
+        expansion.stack.clear();
+    if (rows[r].type != TabularizedRow::OPEN)
+        return;
+    for (auto i = (uint32_t)r + 1, end = subtreeEnd(r); i < end; ++i)
+        if (rows[i].type == TabularizedRow::OPEN)
+            expandedIds.erase(idOf(rows[i].entry));
+    close(r);
+}
+
+bool ConcreteTabularizedViewOfTree::expandSome(uint32_t rowBudget)
+{
+    if (!isExpanding())
+        return false;
+
+    // Rows are produced in display order at one advancing position, which is where the
+    // gap buffer's gap already is, so each costs a constant amount
+    auto start = expansion.nextRow;
+    auto emit = [&](const TabularizedRow &tr) {
+        rows.insert(expansion.nextRow, 1, [&](size_t) { return tr; });
+        expansion.nextRow++;
+        rowMap.valid = false;
+    };
+
+    uint32_t emitted{0};
+    while (emitted < rowBudget && !expansion.stack.empty())
+    {
+        auto &c = expansion.stack.back();
+        if (c.position >= c.entry->getChildCount())
+        {
+            if (c.entry->getChildState() == TreeTableData::Entry::LOADING)
+            {
+                auto ph = TabularizedRow();
+                ph.entry = c.entry;
+                ph.depth = c.depth + 1;
+                ph.type = TabularizedRow::PLACEHOLDER;
+                emit(ph);
+                emitted++;
+            }
+            expansion.stack.pop_back();
+            continue;
+        }
+
+        auto e = c.entry;
+        auto tr = rowForChild(e, childAtPosition(e, c.position), c.depth + 1);
+        c.position++;
+
+        auto descend = tr.type == TabularizedRow::CLOSED && tr.depth < expansion.maxDepth;
+        if (tr.type == TabularizedRow::CLOSED && !descend)
+            expandedIds.erase(idOf(tr.entry));
+        if (descend)
+        {
+            tr.type = TabularizedRow::OPEN;
+            expandedIds.insert(idOf(tr.entry));
+            if (tr.entry->getChildState() == TreeTableData::Entry::LOADING)
+                tr.entry->requestChildren();
+        }
+        emit(tr);
+        emitted++;
+        if (descend)
+            expansion.stack.push_back({tr.entry, 0, tr.depth});
+    }
+
+    if (emitted > 0)
+    {
+        // the rows are already in place, so only the listeners need telling
+        for (auto *l : listeners)
+            l->rowsInserted(start, emitted);
+    }
+    return isExpanding();
+}
 } // namespace sst::jucegui::data
\ No newline at end of file
@@ -32,8 +32,12 @@
 #include <sst/jucegui/components/WindowPanel.h>
 #include <sst/jucegui/components/Label.h>
 #include <sst/jucegui/util/DebugHelpers.h>
+#include <sst/jucegui/util/Logging.h>
 
 #include <cassert>
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
 
 namespace sst::jucegui::style
 {
@@ -95,6 +99,9 @@ struct StyleSheetBuiltInImpl : public StyleSheet
     bool hasColour(const Class &c, const Property &p) const override
     {
         assert(p.type == Property::COLOUR);
+#if SST_JUCEGUI_STYLE_STATS
+        countLookup(c, p, "hasColour", 0);
+#endif
         auto byC = colours.find(c.cname);
         if (byC != colours.end())
         {
@@ -106,6 +113,17 @@ struct StyleSheetBuiltInImpl : public StyleSheet
     }
 
     juce::Colour getColour(const Class &c, const Property &p) const override
+    {
+        uint32_t hops{0};
+        auto res = resolveColour(c, p, hops);
+#if SST_JUCEGUI_STYLE_STATS
+        countLookup(c, p, "getColour", hops);
+#endif
+        return res;
+    }
+
+    // hops counts the base classes walked to find the property
+    juce::Colour resolveColour(const Class &c, const Property &p, uint32_t &hops) const
     {
         assert(p.type == Property::COLOUR);
         auto byC = colours.find(c.cname);
@@ -127,17 +145,20 @@ struct StyleSheetBuiltInImpl : public StyleSheet
             // FIXME gross still not right
             for (const auto &k : parC->second)
             {
-                return getColour({k.c_str()}, p);
+                return resolveColour({k.c_str()}, p, ++hops);
             }
         }
         jassertfalse;
-        std::cout << "No Color " << c.cname << " " << p.pname << std::endl;
+        SST_JUCEGUI_LOG(WARNING, "No colour for " << c.cname << " / " << p.pname);
         return juce::Colours::red;
     }
 
     bool hasFont(const Class &c, const Property &p) const override
     {
         assert(p.type == Property::FONT);
+#if SST_JUCEGUI_STYLE_STATS
+        countLookup(c, p, "hasFont", 0);
+#endif
         auto byC = fonts.find(c.cname);
         if (byC != fonts.end())
         {
@@ -149,6 +170,16 @@ struct StyleSheetBuiltInImpl : public StyleSheet
     }
 
     juce::Font getFont(const Class &c, const Property &p) const override
+    {
+        uint32_t hops{0};
+        auto res = resolveFont(c, p, hops);
+#if SST_JUCEGUI_STYLE_STATS
+        countLookup(c, p, "getFont", hops);
+#endif
+        return res;
+    }
+
+    juce::Font resolveFont(const Class &c, const Property &p, uint32_t &hops) const
     {
         assert(p.type == Property::FONT);
         auto byC = fonts.find(c.cname);
@@ -167,9 +198,10 @@ struct StyleSheetBuiltInImpl : public StyleSheet
         {
             // FIXME gross still not right
             for (const auto &k : parC->second)
-                return getFont({k.c_str()}, p);
+                return resolveFont({k.c_str()}, p, ++hops);
         }
         jassertfalse;
+        SST_JUCEGUI_LOG(WARNING, "No font for " << c.cname << " / " << p.pname);
         return juce::Font(36, juce::Font::italic);
     }
 };
@@ -275,6 +307,7 @@ struct DarkSheet : public StyleSheetBuiltInImpl
             setColour(n::styleClass, n::toggleglyphhovercol, juce::Colour(0xFF, 90, 80));
 
             setColour(n::styleClass, n::connectorcol, juce::Colour(160, 160, 160));
+            setColour(n::styleClass, n::selectedrowcol, juce::Colour(60, 70, 100));
         }
     }
 };
@@ -380,6 +413,7 @@ struct LightSheet : public StyleSheetBuiltInImpl
             setColour(n::styleClass, n::toggleglyphhovercol, juce::Colour(0xFF, 90, 80));
 
             setColour(n::styleClass, n::connectorcol, juce::Colour(160, 160, 160));
+            setColour(n::styleClass, n::selectedrowcol, juce::Colour(200, 215, 240));
         }
     }
 };
@@ -493,4 +527,65 @@ void StyleSheet::initializeStyleSheets(std::function<void()> userClassInitialize
 
     userClassInitializers();
 }
+#if SST_JUCEGUI_STYLE_STATS
+namespace
+{
+// keyed by kind, class and property, NUL separated
+std::unordered_map<std::string, StyleSheet::LookupStat> lookupStats;
+} // namespace
+
+void StyleSheet::countLookup(const Class &c, const Property &p, const char *kind, uint32_t hops)
+{
+    auto key = std::string(kind) + '\0' + c.cname + '\0' + p.pname;
+    auto it = lookupStats.find(key);
+    if (it == lookupStats.end())
+        it = lookupStats.emplace(key, LookupStat{c.cname, p.pname, kind}).first;
+    auto &s = it->second;
+    s.count++;
+    s.totalHops += hops;
+    s.maxHops = std::max(s.maxHops, hops);
+}
+
+std::vector<StyleSheet::LookupStat> StyleSheet::getLookupStats()
+{
+    std::vector<LookupStat> res;
+    res.reserve(lookupStats.size());
+    for (const auto &[k, s] : lookupStats)
+        res.push_back(s);
+    return res;
+}
+
+std::string StyleSheet::getLookupReport(size_t topN)
+{
+    auto stats = getLookupStats();
+    uint64_t total{0}, hops{0};
+    for (const auto &s : stats)
+    {
+        total += s.count;
+        hops += s.totalHops;
+    }
+
+    std::ostringstream oss;
+    oss << "Style lookups: " << total << " over " << stats.size() << " class/property pairs, "
+        << hops << " inheritance hops\n";
+    auto section = [&](const char *title, auto better) {
+        std::sort(stats.begin(), stats.end(), better);
+        oss << title << "\n";
+        for (size_t i = 0; i < std::min(topN, stats.size()); ++i)
+        {
+            const auto &s = stats[i];
+            oss << "  " << std::setw(10) << s.count << " calls " << std::setw(3) << s.maxHops
+                << " max hops " << std::setw(12) << s.totalHops << " total hops  " << s.kind
+                << " " << s.className << " / " << s.propertyName << "\n";
+        }
+    };
+    section("Hottest", [](const auto &a, const auto &b) { return a.count > b.count; });
+    section("Deepest", [](const auto &a, const auto &b) {
+        return a.maxHops != b.maxHops ? a.maxHops > b.maxHops : a.totalHops > b.totalHops;
+    });
+    return oss.str();
+}
+
+void StyleSheet::resetLookupStats() { lookupStats.clear(); }
+#endif
 } // namespace sst::jucegui::style